@@ -0,0 +1,176 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_BENCHMARK_HPP
+#define CRYPTO3_HASH_BENCHMARK_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#define CRYPTO3_HASH_BENCHMARK_HAS_TSC
+#endif
+
+namespace nil {
+    namespace crypto3 {
+        namespace benchmark {
+            /*!
+             * @brief Keeps the compiler from discarding a computed value.
+             */
+            template<typename Range>
+            inline void consume(const Range &r) {
+                static volatile std::uint8_t sink;
+                for (auto v : r) {
+                    sink = sink ^ static_cast<std::uint8_t>(v);
+                }
+            }
+
+            /*!
+             * @brief Runs f repeatedly for at least min_seconds and returns the mean duration of a single run
+             * in seconds.
+             */
+            template<typename F>
+            double measure(F &&f, double min_seconds = 0.5) {
+                typedef std::chrono::steady_clock clock_type;
+
+                f();
+
+                std::size_t runs = 0;
+                double elapsed = 0;
+                clock_type::time_point start = clock_type::now();
+                do {
+                    f();
+                    ++runs;
+                    elapsed = std::chrono::duration<double>(clock_type::now() - start).count();
+                } while (elapsed < min_seconds);
+
+                return elapsed / runs;
+            }
+
+            /*!
+             * @brief Reads the time stamp counter, or returns 0 where there is none. On current x86 CPUs
+             * the TSC ticks at a constant reference rate, so "cycles" are reference cycles: they match core
+             * cycles with frequency scaling and turbo disabled.
+             */
+            inline std::uint64_t cycle_counter() {
+#ifdef CRYPTO3_HASH_BENCHMARK_HAS_TSC
+                return __rdtsc();
+#else
+                return 0;
+#endif
+            }
+
+            inline bool has_cycle_counter() {
+#ifdef CRYPTO3_HASH_BENCHMARK_HAS_TSC
+                return true;
+#else
+                return false;
+#endif
+            }
+
+            struct measurement {
+                double seconds;
+                double cycles;
+            };
+
+            /*!
+             * @brief Like measure, but also returns the mean number of cycle_counter ticks per run.
+             */
+            template<typename F>
+            measurement measure_cycles(F &&f, double min_seconds = 0.5) {
+                typedef std::chrono::steady_clock clock_type;
+
+                f();
+
+                std::size_t runs = 0;
+                double elapsed = 0;
+                clock_type::time_point start = clock_type::now();
+                std::uint64_t start_cycles = cycle_counter();
+                do {
+                    f();
+                    ++runs;
+                    elapsed = std::chrono::duration<double>(clock_type::now() - start).count();
+                } while (elapsed < min_seconds);
+
+                measurement m = {elapsed / runs, double(cycle_counter() - start_cycles) / runs};
+                return m;
+            }
+
+            inline double median(std::vector<double> samples) {
+                if (samples.empty()) {
+                    return 0;
+                }
+                std::size_t middle = samples.size() / 2;
+                std::nth_element(samples.begin(), samples.begin() + middle, samples.end());
+                if (samples.size() % 2) {
+                    return samples[middle];
+                }
+                return (samples[middle] + *std::max_element(samples.begin(), samples.begin() + middle)) / 2;
+            }
+
+            /*!
+             * @brief Median absolute deviation from the median. Multiplied by 1.4826 it estimates the
+             * standard deviation of normally distributed samples, but unlike it is not thrown off by the
+             * occasional run disturbed by the scheduler.
+             */
+            inline double median_absolute_deviation(const std::vector<double> &samples) {
+                double m = median(samples);
+                std::vector<double> deviations;
+                for (double x : samples) {
+                    deviations.push_back(std::abs(x - m));
+                }
+                return median(deviations);
+            }
+
+            inline void report(const std::string &name, std::size_t bytes, double seconds) {
+                std::printf("%-56s %14.1f ns/op %10.1f MB/s\n", name.c_str(), seconds * 1e9,
+                            seconds > 0 ? bytes / seconds / 1e6 : 0.0);
+            }
+
+            inline std::vector<std::uint8_t> make_input(std::size_t size) {
+                std::vector<std::uint8_t> in(size);
+                std::uint32_t x = 0x9e3779b9;
+                for (std::size_t i = 0; i < size; ++i) {
+                    x ^= x << 13;
+                    x ^= x >> 17;
+                    x ^= x << 5;
+                    in[i] = static_cast<std::uint8_t>(x);
+                }
+                return in;
+            }
+        }    // namespace benchmark
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_BENCHMARK_HPP
@@ -0,0 +1,79 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// Compares contiguous input, which is packed block by block straight from memory,
+// with non-contiguous input, which goes value by value through the stream processor cache.
+//---------------------------------------------------------------------------//
+
+#include <deque>
+#include <string>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+
+#include <nil/crypto3/hash/blake2b.hpp>
+#include <nil/crypto3/hash/keccak.hpp>
+#include <nil/crypto3/hash/md4.hpp>
+#include <nil/crypto3/hash/md5.hpp>
+#include <nil/crypto3/hash/ripemd.hpp>
+#include <nil/crypto3/hash/sha1.hpp>
+#include <nil/crypto3/hash/sha2.hpp>
+#include <nil/crypto3/hash/sha3.hpp>
+#include <nil/crypto3/hash/tiger.hpp>
+
+#include "benchmark.hpp"
+
+using namespace nil::crypto3;
+
+template<typename Hash>
+void run(const std::string &name, const std::vector<std::uint8_t> &contiguous,
+         const std::deque<std::uint8_t> &by_value) {
+    double t = benchmark::measure([&]() {
+        typename Hash::digest_type d = hash<Hash>(contiguous.begin(), contiguous.end());
+        benchmark::consume(d);
+    });
+    benchmark::report(name + " contiguous", contiguous.size(), t);
+
+    t = benchmark::measure([&]() {
+        typename Hash::digest_type d = hash<Hash>(by_value.begin(), by_value.end());
+        benchmark::consume(d);
+    });
+    benchmark::report(name + " by value", by_value.size(), t);
+}
+
+int main() {
+    std::vector<std::uint8_t> contiguous = benchmark::make_input(16 * 1024 * 1024);
+    std::deque<std::uint8_t> by_value(contiguous.begin(), contiguous.end());
+
+    run<hashes::md4>("md4", contiguous, by_value);
+    run<hashes::md5>("md5", contiguous, by_value);
+    run<hashes::sha1>("sha1", contiguous, by_value);
+    run<hashes::sha2<256>>("sha2<256>", contiguous, by_value);
+    run<hashes::sha2<512>>("sha2<512>", contiguous, by_value);
+    run<hashes::ripemd160>("ripemd160", contiguous, by_value);
+    run<hashes::tiger<192>>("tiger<192>", contiguous, by_value);
+    run<hashes::keccak_1600<256>>("keccak_1600<256>", contiguous, by_value);
+    run<hashes::sha3<256>>("sha3<256>", contiguous, by_value);
+    run<hashes::blake2b<512>>("blake2b<512>", contiguous, by_value);
+
+    return 0;
+}
@@ -0,0 +1,134 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// Text forms of static_digest: the nibble-at-a-time to_ascii, allocating std::to_string and locale-bound
+// operator>> against the caller-buffer to_hex/from_hex, to_base64url and to_base32.
+//---------------------------------------------------------------------------//
+
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <nil/crypto3/detail/static_digest.hpp>
+
+#include "benchmark.hpp"
+
+using namespace nil::crypto3;
+
+template<std::size_t DigestBits>
+void run(std::size_t count) {
+    constexpr std::size_t hex_size = digest_encoded_size<DigestBits>::hex;
+    const std::string suffix = " (" + std::to_string(DigestBits) + "-bit)";
+    const std::size_t bytes = DigestBits / octet_bits;
+
+    std::vector<static_digest<DigestBits>> digests(count);
+    std::vector<std::uint8_t> in = benchmark::make_input(count * bytes);
+    for (std::size_t i = 0; i != count; ++i) {
+        std::memcpy(digests[i].data(), in.data() + i * digests[i].size(), digests[i].size());
+    }
+    std::vector<char> text(count * hex_size);
+
+    double t = benchmark::measure([&]() {
+        char *p = text.data();
+        for (const static_digest<DigestBits> &d : digests) {
+            p = detail::to_ascii(d, p);
+        }
+        benchmark::consume(std::array<char, 1> {{text.back()}});
+    });
+    benchmark::report("to_ascii" + suffix, bytes, t / count);
+
+    t = benchmark::measure([&]() {
+        std::size_t n = 0;
+        for (const static_digest<DigestBits> &d : digests) {
+            n += std::to_string(d).size();
+        }
+        benchmark::consume(std::array<std::size_t, 1> {{n}});
+    });
+    benchmark::report("std::to_string" + suffix, bytes, t / count);
+
+    t = benchmark::measure([&]() {
+        char *p = text.data();
+        for (const static_digest<DigestBits> &d : digests) {
+            p = to_hex(d, p);
+        }
+        benchmark::consume(std::array<char, 1> {{text.back()}});
+    });
+    benchmark::report("to_hex" + suffix, bytes, t / count);
+
+    std::vector<static_digest<DigestBits>> parsed(count);
+    const std::string joined(text.begin(), text.end());
+    t = benchmark::measure([&]() {
+        std::istringstream source(joined);
+        for (static_digest<DigestBits> &d : parsed) {
+            source >> d;
+        }
+        benchmark::consume(std::array<std::uint8_t, 1> {{parsed.back()[0]}});
+    });
+    benchmark::report("operator>>" + suffix, bytes, t / count);
+
+    t = benchmark::measure([&]() {
+        const char *p = text.data();
+        for (static_digest<DigestBits> &d : parsed) {
+            from_hex(p, hex_size, d);
+            p += hex_size;
+        }
+        benchmark::consume(std::array<std::uint8_t, 1> {{parsed.back()[0]}});
+    });
+    benchmark::report("from_hex" + suffix, bytes, t / count);
+
+    t = benchmark::measure([&]() {
+        char *p = text.data();
+        for (const static_digest<DigestBits> &d : digests) {
+            p = to_base64url(d, p);
+        }
+        benchmark::consume(std::array<char, 1> {{text.front()}});
+    });
+    benchmark::report("to_base64url" + suffix, bytes, t / count);
+
+    t = benchmark::measure([&]() {
+        char *p = text.data();
+        for (const static_digest<DigestBits> &d : digests) {
+            p = to_base32(d, p);
+        }
+        benchmark::consume(std::array<char, 1> {{text.front()}});
+    });
+    benchmark::report("to_base32" + suffix, bytes, t / count);
+}
+
+int main() {
+#if !defined(CRYPTO3_DISABLE_CPU_EXTENSIONS) && defined(__AVX2__)
+    std::printf("hex encoding: avx2\n");
+#elif !defined(CRYPTO3_DISABLE_CPU_EXTENSIONS) && defined(__SSSE3__)
+    std::printf("hex encoding: ssse3\n");
+#else
+    std::printf("hex encoding: scalar\n");
+#endif
+
+    run<256>(4096);
+    run<512>(4096);
+
+    return 0;
+}
@@ -0,0 +1,161 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// static_digest as a container key: std::unordered_set with std::hash against hashing every octet,
+// std::set with the lexicographic operator<, and operator== against std::equal.
+//
+// Usage: hash_digest_key_benchmark [entries], 1000000 by default. The dedup table sizing the change was
+// made for is hash_digest_key_benchmark 100000000, which needs about 8 GiB.
+//---------------------------------------------------------------------------//
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <set>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <boost/functional/hash.hpp>
+
+#include <nil/crypto3/detail/static_digest.hpp>
+
+#include "benchmark.hpp"
+
+using namespace nil::crypto3;
+
+typedef static_digest<256> digest_type;
+
+/*!
+ * @brief What keying unordered containers by digest took before std::hash was specialized.
+ */
+struct octets_hash {
+    std::size_t operator()(const digest_type &d) const {
+        return boost::hash_range(d.begin(), d.end());
+    }
+};
+
+template<typename F>
+double once(F &&f) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+std::vector<digest_type> make_digests(std::size_t count, std::uint64_t seed) {
+    std::vector<digest_type> r(count);
+    for (digest_type &d : r) {
+        for (std::size_t i = 0; i != d.size(); i += sizeof(seed)) {
+            seed ^= seed << 13;
+            seed ^= seed >> 7;
+            seed ^= seed << 17;
+            std::memcpy(d.data() + i, &seed, sizeof(seed));
+        }
+    }
+    return r;
+}
+
+template<typename Hash>
+void run_unordered(const std::string &name, const std::vector<digest_type> &keys,
+                   const std::vector<digest_type> &misses) {
+    std::unordered_set<digest_type, Hash> set;
+    set.reserve(keys.size());
+
+    double t = once([&]() {
+        for (const digest_type &d : keys) {
+            set.insert(d);
+        }
+    });
+    benchmark::report(name + " insert", digest_type().size(), t / keys.size());
+
+    std::size_t found = 0;
+    t = once([&]() {
+        for (const digest_type &d : keys) {
+            found += set.count(d);
+        }
+    });
+    benchmark::report(name + " hit", digest_type().size(), t / keys.size());
+
+    t = once([&]() {
+        for (const digest_type &d : misses) {
+            found += set.count(d);
+        }
+    });
+    benchmark::report(name + " miss", digest_type().size(), t / misses.size());
+    benchmark::consume(std::array<std::size_t, 1> {{found}});
+}
+
+int main(int argc, char *argv[]) {
+    const std::size_t entries = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    std::printf("entries: %zu\n", entries);
+
+    const std::vector<digest_type> keys = make_digests(entries, 0x9e3779b97f4a7c15);
+    const std::vector<digest_type> misses = make_digests(entries < 1000000 ? entries : 1000000, 0x2545f4914f6cdd1d);
+
+    run_unordered<std::hash<digest_type>>("unordered_set, std::hash", keys, misses);
+    run_unordered<octets_hash>("unordered_set, hash of all octets", keys, misses);
+
+    {
+        std::set<digest_type> set;
+        double t = once([&]() {
+            for (const digest_type &d : keys) {
+                set.insert(d);
+            }
+        });
+        benchmark::report("set insert", digest_type().size(), t / keys.size());
+        std::printf("set size: %zu\n", set.size());
+
+        std::size_t found = 0;
+        t = once([&]() {
+            for (const digest_type &d : misses) {
+                found += set.count(d);
+            }
+        });
+        benchmark::report("set miss", digest_type().size(), t / misses.size());
+        benchmark::consume(std::array<std::size_t, 1> {{found}});
+    }
+
+    // Equal digests are the worst case of an early exit comparison and the only case of a constant-time one
+    std::vector<digest_type> copies(keys.begin(), keys.begin() + (entries < 4096 ? entries : 4096));
+    const std::size_t n = copies.size();
+    double t = benchmark::measure([&]() {
+        std::size_t equal = 0;
+        for (std::size_t i = 0; i != n; ++i) {
+            equal += std::equal(keys[i].begin(), keys[i].end(), copies[i].begin());
+        }
+        benchmark::consume(std::array<std::size_t, 1> {{equal}});
+    });
+    benchmark::report("std::equal", digest_type().size(), t / n);
+
+    t = benchmark::measure([&]() {
+        std::size_t equal = 0;
+        for (std::size_t i = 0; i != n; ++i) {
+            equal += keys[i] == copies[i];
+        }
+        benchmark::consume(std::array<std::size_t, 1> {{equal}});
+    });
+    benchmark::report("operator==", digest_type().size(), t / n);
+
+    return 0;
+}
@@ -0,0 +1,74 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+// Scaling of hash_batch with the number of threads, 1 to the number of hardware threads.
+//---------------------------------------------------------------------------//
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <nil/crypto3/hash/algorithm/hash_batch.hpp>
+
+#include <nil/crypto3/hash/blake2b.hpp>
+#include <nil/crypto3/hash/sha2.hpp>
+#include <nil/crypto3/hash/sha3.hpp>
+
+#include "benchmark.hpp"
+
+using namespace nil::crypto3;
+
+template<typename Hash>
+void run(const std::string &name, std::size_t size) {
+    const std::size_t messages = size < 1024 ? 100000 : 10000;
+
+    std::vector<std::vector<std::uint8_t>> input(messages, benchmark::make_input(size));
+    std::vector<typename Hash::digest_type> digests(messages);
+
+    std::size_t hardware_threads = std::max(1u, std::thread::hardware_concurrency());
+    for (std::size_t threads = 1;; threads = std::min(threads * 2, hardware_threads)) {
+        hashes::thread_pool pool(threads);
+        double t = benchmark::measure([&]() {
+            hash_batch<Hash>(input, digests.begin(), pool);
+            benchmark::consume(digests.back());
+        });
+        benchmark::report(name + ", " + std::to_string(size) + " bytes, " + std::to_string(threads) + " threads",
+                          size * messages, t);
+
+        if (threads == hardware_threads) {
+            break;
+        }
+    }
+}
+
+int main() {
+    for (std::size_t size : {64, 1024, 16384}) {
+        run<hashes::sha2<256>>("sha2<256>", size);
+        run<hashes::sha2<512>>("sha2<512>", size);
+        run<hashes::sha3<256>>("sha3<256>", size);
+        run<hashes::blake2b<512>>("blake2b<512>", size);
+    }
+
+    return 0;
+}
@@ -0,0 +1,385 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+// Throughput matrix of every enabled hash family over a range of message sizes and over the public entry
+// points: hash<>() over iterators, the adaptors::hashed pipe, hashing into a caller-owned accumulator_set and
+// hashes::hasher. Families follow the CRYPTO3_HAS_* definitions set by the CRYPTO3_HASH_* options.
+//
+// Usage: hash_benchmarks [--min-time seconds] [--repetitions n] [--filter substring] [--output file]
+//                        [--baseline file [--threshold fraction]]
+//
+// Writes JSON to stdout, or to --output:
+// {"cycle_counter": "tsc" | null, "results": [{"hash": ..., "entry": ..., "size": ..., "repetitions": ...,
+//  "ns_per_message": ..., "ns_mad": ..., "cycles_per_message": ..., "cycles_per_byte": ...}, ...]}
+// Every cell is timed --repetitions times; ns_per_message and cycles_* are medians, ns_mad is the median
+// absolute deviation of ns_per_message. cycles_* are null without a cycle counter, cycles_per_byte is null
+// for empty messages.
+//
+// A run saved with --output (or redirected) serves as a baseline for later runs. With --baseline, every cell
+// also present in the baseline is compared against it; a cell regressed if its median is more than
+// --threshold (default 0.1, i.e. 10%) slower and the difference exceeds three standard deviations of the
+// noise, estimated from the MADs of both runs. The exit status is 1 if any cell regressed, 2 on usage or
+// baseline errors.
+//---------------------------------------------------------------------------//
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/adaptor/hashed.hpp>
+#include <nil/crypto3/hash/hasher.hpp>
+
+#ifdef CRYPTO3_HAS_BLAKE2B
+#include <nil/crypto3/hash/blake2b.hpp>
+#endif
+#ifdef CRYPTO3_HAS_KECCAK
+#include <nil/crypto3/hash/keccak.hpp>
+#endif
+#ifdef CRYPTO3_HAS_MD4
+#include <nil/crypto3/hash/md4.hpp>
+#endif
+#ifdef CRYPTO3_HAS_MD5
+#include <nil/crypto3/hash/md5.hpp>
+#endif
+#ifdef CRYPTO3_HAS_RIPEMD
+#include <nil/crypto3/hash/ripemd.hpp>
+#endif
+#ifdef CRYPTO3_HAS_SHA1
+#include <nil/crypto3/hash/sha1.hpp>
+#endif
+#if defined(CRYPTO3_HAS_SHA2_32) || defined(CRYPTO3_HAS_SHA2_64)
+#include <nil/crypto3/hash/sha2.hpp>
+#endif
+#ifdef CRYPTO3_HAS_SHA3
+#include <nil/crypto3/hash/sha3.hpp>
+#endif
+#ifdef CRYPTO3_HAS_TIGER
+#include <nil/crypto3/hash/tiger.hpp>
+#endif
+#ifdef CRYPTO3_HAS_POSEIDON
+#include <nil/crypto3/hash/poseidon.hpp>
+#include <nil/crypto3/algebra/fields/bls12/scalar_field.hpp>
+#endif
+
+#include "benchmark.hpp"
+
+using namespace nil::crypto3;
+
+struct options_type {
+    double min_seconds = 0.2;
+    std::size_t repetitions = 1;
+    std::string filter;
+    std::string output;
+    std::string baseline;
+    double threshold = 0.1;
+};
+
+struct result_type {
+    std::string hash;
+    std::string entry;
+    std::size_t size;
+
+    std::vector<double> ns;
+    std::vector<double> cycles;
+};
+
+const std::size_t sizes[] = {0, 64, 256, 1024, 64 * 1024, 16 * 1024 * 1024};
+
+// Small messages are hashed in batches per timed run, so the clock is read once per ~1 MiB of input
+std::size_t batch_messages(std::size_t size) {
+    return std::max<std::size_t>(1, (1 << 20) / std::max<std::size_t>(size, 64));
+}
+
+template<typename F>
+void measure(std::vector<result_type> &results, const options_type &options, const std::string &hash,
+             const std::string &entry, std::size_t size, F f) {
+    if ((hash + " " + entry).find(options.filter) == std::string::npos) {
+        return;
+    }
+
+    result_type r = result_type();
+    r.hash = hash;
+    r.entry = entry;
+    r.size = size;
+
+    const std::size_t messages = batch_messages(size);
+    for (std::size_t i = 0; i != options.repetitions; ++i) {
+        benchmark::measurement m = benchmark::measure_cycles(
+            [&]() {
+                for (std::size_t j = 0; j != messages; ++j) {
+                    f();
+                }
+            },
+            options.min_seconds);
+        r.ns.push_back(m.seconds * 1e9 / messages);
+        r.cycles.push_back(m.cycles / messages);
+    }
+
+    results.push_back(r);
+    std::fprintf(stderr, "%-24s %-12s %9zu %14.1f ns\n", hash.c_str(), entry.c_str(), size,
+                 benchmark::median(r.ns));
+}
+
+template<typename Hash>
+void run(std::vector<result_type> &results, const options_type &options, const std::string &name) {
+    for (std::size_t size : sizes) {
+        const std::vector<std::uint8_t> in = benchmark::make_input(size);
+
+        measure(results, options, name, "hash", size, [&]() {
+            typename Hash::digest_type d = hash<Hash>(in.begin(), in.end());
+            benchmark::consume(d);
+        });
+
+        measure(results, options, name, "hashed", size, [&]() {
+            typename Hash::digest_type d = in | adaptors::hashed<Hash>;
+            benchmark::consume(d);
+        });
+
+        measure(results, options, name, "accumulator", size, [&]() {
+            accumulator_set<Hash> acc;
+            hash<Hash>(in.begin(), in.end(), acc);
+            typename Hash::digest_type d = accumulators::extract::hash<Hash>(acc);
+            benchmark::consume(d);
+        });
+
+        measure(results, options, name, "hasher", size, [&]() {
+            hashes::hasher<Hash> h;
+            typename Hash::digest_type d = h.update(in).finalize();
+            benchmark::consume(d);
+        });
+    }
+}
+
+#ifdef CRYPTO3_HAS_POSEIDON
+// Poseidon has no octet-stream construction yet, so its permutation is measured instead; size is the
+// number of octets of field elements absorbed per permutation.
+template<std::size_t Arity, std::size_t PartRounds>
+void run_poseidon(std::vector<result_type> &results, const options_type &options) {
+    typedef algebra::fields::bls12_fr<381> field_type;
+    typedef hashes::detail::poseidon_functions<field_type, Arity, PartRounds> functions_type;
+    typedef typename functions_type::element_type element_type;
+    typedef typename element_type::modulus_type modulus_type;
+
+    typename functions_type::state_type state;
+    for (std::size_t i = 0; i != functions_type::state_words; ++i) {
+        state[i] = element_type(modulus_type(i + 1));
+    }
+
+    const std::string name = "poseidon<bls12_fr<381>, " + std::to_string(Arity) + ">";
+    const std::size_t size = Arity * ((field_type::modulus_bits + 7) / 8);
+    measure(results, options, name, "permute", size, [&]() { functions_type::permute(state); });
+    measure(results, options, name, "permute_optimized", size,
+            [&]() { functions_type::permute_optimized(state); });
+}
+#endif
+
+void print_number(std::FILE *out, double value, bool valid) {
+    if (valid) {
+        std::fprintf(out, "%.3f", value);
+    } else {
+        std::fprintf(out, "null");
+    }
+}
+
+void print_json(std::FILE *out, const std::vector<result_type> &results) {
+    const bool cycles = benchmark::has_cycle_counter();
+
+    std::fprintf(out, "{\n  \"cycle_counter\": %s,\n  \"results\": [", cycles ? "\"tsc\"" : "null");
+    for (std::size_t i = 0; i != results.size(); ++i) {
+        const result_type &r = results[i];
+        const double cycles_per_message = benchmark::median(r.cycles);
+
+        std::fprintf(out, "%s\n    {\"hash\": \"%s\", \"entry\": \"%s\", \"size\": %zu, \"repetitions\": %zu, ",
+                     i ? "," : "", r.hash.c_str(), r.entry.c_str(), r.size, r.ns.size());
+        std::fprintf(out, "\"ns_per_message\": ");
+        print_number(out, benchmark::median(r.ns), true);
+        std::fprintf(out, ", \"ns_mad\": ");
+        print_number(out, benchmark::median_absolute_deviation(r.ns), true);
+        std::fprintf(out, ", \"cycles_per_message\": ");
+        print_number(out, cycles_per_message, cycles);
+        std::fprintf(out, ", \"cycles_per_byte\": ");
+        print_number(out, r.size ? cycles_per_message / r.size : 0, cycles && r.size);
+        std::fprintf(out, "}");
+    }
+    std::fprintf(out, "\n  ]\n}\n");
+}
+
+/*!
+ * @brief Compares results against a baseline written by an earlier run.
+ * @return The number of regressed cells, or -1 if the baseline can't be read.
+ */
+int compare(const std::vector<result_type> &results, const options_type &options) {
+    typedef std::tuple<std::string, std::string, std::size_t> key_type;
+    std::map<key_type, std::pair<double, double>> baseline;
+
+    try {
+        boost::property_tree::ptree tree;
+        boost::property_tree::read_json(options.baseline, tree);
+        for (const auto &cell : tree.get_child("results")) {
+            const boost::property_tree::ptree &r = cell.second;
+            baseline[key_type(r.get<std::string>("hash"), r.get<std::string>("entry"), r.get<std::size_t>("size"))] =
+                std::make_pair(r.get<double>("ns_per_message"), r.get<double>("ns_mad", 0));
+        }
+    } catch (const boost::property_tree::ptree_error &e) {
+        std::fprintf(stderr, "can't read baseline %s: %s\n", options.baseline.c_str(), e.what());
+        return -1;
+    }
+
+    // Scales a MAD to a standard deviation estimate for normally distributed noise
+    const double mad_to_sigma = 1.4826;
+    const double significance = 3;
+
+    int regressions = 0;
+    std::fprintf(stderr, "\n%-24s %-12s %9s %14s %14s %8s\n", "hash", "entry", "size", "baseline ns", "ns",
+                 "change");
+    for (const result_type &r : results) {
+        auto it = baseline.find(key_type(r.hash, r.entry, r.size));
+        if (it == baseline.end() || it->second.first <= 0) {
+            continue;
+        }
+
+        const double base = it->second.first, base_mad = it->second.second;
+        const double current = benchmark::median(r.ns), mad = benchmark::median_absolute_deviation(r.ns);
+        const double change = current / base - 1;
+        const double noise = significance * mad_to_sigma * std::sqrt(base_mad * base_mad + mad * mad);
+
+        const bool regressed = change > options.threshold && current - base > noise;
+        const bool improved = -change > options.threshold && base - current > noise;
+        regressions += regressed;
+
+        std::fprintf(stderr, "%-24s %-12s %9zu %14.1f %14.1f %+7.1f%% %s\n", r.hash.c_str(), r.entry.c_str(),
+                     r.size, base, current, change * 100,
+                     regressed ? "REGRESSION" :
+                     improved  ? "improved" :
+                                 "");
+    }
+    std::fprintf(stderr, "%d regression(s) over %.0f%%\n", regressions, options.threshold * 100);
+
+    return regressions;
+}
+
+int main(int argc, char *argv[]) {
+    options_type options;
+    for (int i = 1; i < argc; ++i) {
+        if (!std::strcmp(argv[i], "--min-time") && i + 1 < argc) {
+            options.min_seconds = std::atof(argv[++i]);
+        } else if (!std::strcmp(argv[i], "--repetitions") && i + 1 < argc) {
+            options.repetitions = std::max(1, std::atoi(argv[++i]));
+        } else if (!std::strcmp(argv[i], "--filter") && i + 1 < argc) {
+            options.filter = argv[++i];
+        } else if (!std::strcmp(argv[i], "--output") && i + 1 < argc) {
+            options.output = argv[++i];
+        } else if (!std::strcmp(argv[i], "--baseline") && i + 1 < argc) {
+            options.baseline = argv[++i];
+        } else if (!std::strcmp(argv[i], "--threshold") && i + 1 < argc) {
+            options.threshold = std::atof(argv[++i]);
+        } else {
+            std::fprintf(stderr,
+                         "usage: %s [--min-time seconds] [--repetitions n] [--filter substring] [--output file]\n"
+                         "       [--baseline file [--threshold fraction]]\n",
+                         argv[0]);
+            return 2;
+        }
+    }
+
+    std::vector<result_type> results;
+
+#ifdef CRYPTO3_HAS_SHA1
+    run<hashes::sha1>(results, options, "sha1");
+#endif
+#ifdef CRYPTO3_HAS_SHA2_32
+    run<hashes::sha2<224>>(results, options, "sha2<224>");
+    run<hashes::sha2<256>>(results, options, "sha2<256>");
+#endif
+#ifdef CRYPTO3_HAS_SHA2_64
+    run<hashes::sha2<384>>(results, options, "sha2<384>");
+    run<hashes::sha2<512>>(results, options, "sha2<512>");
+    run<hashes::sha2<224, 512>>(results, options, "sha2<224, 512>");
+    run<hashes::sha2<256, 512>>(results, options, "sha2<256, 512>");
+#endif
+#ifdef CRYPTO3_HAS_SHA3
+    run<hashes::sha3<224>>(results, options, "sha3<224>");
+    run<hashes::sha3<256>>(results, options, "sha3<256>");
+    run<hashes::sha3<384>>(results, options, "sha3<384>");
+    run<hashes::sha3<512>>(results, options, "sha3<512>");
+#endif
+#ifdef CRYPTO3_HAS_KECCAK
+    run<hashes::keccak_1600<224>>(results, options, "keccak_1600<224>");
+    run<hashes::keccak_1600<256>>(results, options, "keccak_1600<256>");
+    run<hashes::keccak_1600<384>>(results, options, "keccak_1600<384>");
+    run<hashes::keccak_1600<512>>(results, options, "keccak_1600<512>");
+#endif
+#ifdef CRYPTO3_HAS_BLAKE2B
+    run<hashes::blake2b<224>>(results, options, "blake2b<224>");
+    run<hashes::blake2b<256>>(results, options, "blake2b<256>");
+    run<hashes::blake2b<384>>(results, options, "blake2b<384>");
+    run<hashes::blake2b<512>>(results, options, "blake2b<512>");
+#endif
+#ifdef CRYPTO3_HAS_MD4
+    run<hashes::md4>(results, options, "md4");
+#endif
+#ifdef CRYPTO3_HAS_MD5
+    run<hashes::md5>(results, options, "md5");
+#endif
+#ifdef CRYPTO3_HAS_RIPEMD
+    run<hashes::ripemd128>(results, options, "ripemd128");
+    run<hashes::ripemd160>(results, options, "ripemd160");
+    run<hashes::ripemd256>(results, options, "ripemd256");
+    run<hashes::ripemd320>(results, options, "ripemd320");
+#endif
+#ifdef CRYPTO3_HAS_TIGER
+    // tiger<128> and tiger<160> share the three-word IV of tiger<192> in a shorter state and don't compile
+    run<hashes::tiger<192>>(results, options, "tiger<192>");
+#endif
+#ifdef CRYPTO3_HAS_POSEIDON
+    run_poseidon<2, 69>(results, options);
+    run_poseidon<4, 70>(results, options);
+#endif
+
+    std::FILE *out = options.output.empty() ? stdout : std::fopen(options.output.c_str(), "w");
+    if (!out) {
+        std::fprintf(stderr, "can't write %s\n", options.output.c_str());
+        return 2;
+    }
+    print_json(out, results);
+    if (out != stdout) {
+        std::fclose(out);
+    }
+
+    if (!options.baseline.empty()) {
+        int regressions = compare(results, options);
+        return regressions < 0 ? 2 : regressions ? 1 : 0;
+    }
+
+    return 0;
+}
@@ -0,0 +1,129 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+// hash_file throughput, mapped and read, with the file in the page cache (warm) and evicted from it
+// before every run (cold, via POSIX_FADV_DONTNEED, which only drops clean pages). Pass a file path to
+// use an existing file instead of a 256 MiB temporary one.
+//---------------------------------------------------------------------------//
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/algorithm/hash_file.hpp>
+
+#include <nil/crypto3/hash/blake2b.hpp>
+#include <nil/crypto3/hash/sha2.hpp>
+
+#include "benchmark.hpp"
+
+using namespace nil::crypto3;
+
+void evict(const std::string &path) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        ::fdatasync(fd);
+        ::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        ::close(fd);
+    }
+}
+
+template<typename Hash>
+void run(const std::string &name, const std::string &path, std::size_t size) {
+    hashes::file_options mapped, read;
+    read.mmap = false;
+
+    for (int variant = 0; variant != 2; ++variant) {
+        const hashes::file_options &options = variant ? read : mapped;
+        const std::string mode = variant ? " read" : " mmap";
+
+        double warm = benchmark::measure([&]() {
+            typename Hash::digest_type d;
+            hash_file<Hash>(path, d, options);
+            benchmark::consume(d);
+        });
+
+        // Eviction is kept out of the timed region
+        const std::size_t cold_runs = 3;
+        double cold = 0;
+        for (std::size_t i = 0; i != cold_runs; ++i) {
+            evict(path);
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            typename Hash::digest_type d;
+            hash_file<Hash>(path, d, options);
+            benchmark::consume(d);
+            cold += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        }
+        cold /= cold_runs;
+
+        std::printf("%-40s %8.3f GB/s warm %8.3f GB/s cold\n", (name + mode).c_str(), size / warm / 1e9,
+                    size / cold / 1e9);
+    }
+
+    double in_memory = benchmark::measure([&]() {
+        std::vector<std::uint8_t> v(size);
+        int fd = ::open(path.c_str(), O_RDONLY);
+        ssize_t r = ::read(fd, v.data(), v.size());
+        ::close(fd);
+        typename Hash::digest_type d = hash<Hash>(v.begin(), v.begin() + std::max<ssize_t>(r, 0));
+        benchmark::consume(d);
+    });
+    std::printf("%-40s %8.3f GB/s warm\n", (name + " read into vector").c_str(), size / in_memory / 1e9);
+}
+
+int main(int argc, char *argv[]) {
+    std::string path;
+    std::size_t size;
+    bool temporary = argc < 2;
+
+    if (temporary) {
+        char name[] = "/tmp/crypto3_hash_file_benchmark_XXXXXX";
+        int fd = ::mkstemp(name);
+        size = 256 << 20;
+        std::vector<std::uint8_t> content = benchmark::make_input(size);
+        if (fd < 0 || ::write(fd, content.data(), size) != static_cast<ssize_t>(size)) {
+            return 1;
+        }
+        ::close(fd);
+        path = name;
+    } else {
+        path = argv[1];
+        int fd = ::open(path.c_str(), O_RDONLY);
+        size = fd < 0 ? 0 : ::lseek(fd, 0, SEEK_END);
+        ::close(fd);
+    }
+
+    run<hashes::sha2<256>>("sha2<256>", path, size);
+    run<hashes::blake2b<512>>("blake2b<512>", path, size);
+
+    if (temporary) {
+        std::remove(path.c_str());
+    }
+    return 0;
+}
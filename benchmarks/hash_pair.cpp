@@ -0,0 +1,84 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// Merkle node hashing, the digest of two child digests: hash<>() over the 64 octets versus hash_pair, which
+// precomputes the final padding and skips the accumulator, and one tree level at a time with hash_pairs.
+//---------------------------------------------------------------------------//
+
+#include <string>
+#include <vector>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/hash_pair.hpp>
+
+#include "benchmark.hpp"
+
+using namespace nil::crypto3;
+
+template<typename Hash>
+void run(const std::string &name) {
+    typedef typename Hash::digest_type digest_type;
+    const std::size_t pairs = 4096;
+    const std::size_t size = 2 * digest_type().size();
+
+    std::vector<digest_type> children(2 * pairs), parents(pairs);
+    for (std::size_t i = 0; i != children.size(); ++i) {
+        std::vector<std::uint8_t> input = benchmark::make_input(children[i].size());
+        std::copy(input.begin(), input.end(), children[i].begin());
+        children[i][0] = static_cast<std::uint8_t>(i);
+    }
+
+    double t = benchmark::measure([&]() {
+        for (std::size_t i = 0; i != pairs; ++i) {
+            std::array<std::uint8_t, 2 * sizeof(digest_type)> m;
+            std::copy(children[2 * i].begin(), children[2 * i].end(), m.begin());
+            std::copy(children[2 * i + 1].begin(), children[2 * i + 1].end(), m.begin() + children[2 * i].size());
+            digest_type d = hash<Hash>(m);
+            benchmark::consume(d);
+        }
+    });
+    benchmark::report(name + " hash<>()", size, t / pairs);
+
+    t = benchmark::measure([&]() {
+        for (std::size_t i = 0; i != pairs; ++i) {
+            digest_type d = hashes::hash_pair<Hash>(children[2 * i], children[2 * i + 1]);
+            benchmark::consume(d);
+        }
+    });
+    benchmark::report(name + " hash_pair", size, t / pairs);
+
+    t = benchmark::measure([&]() {
+        hashes::hash_pairs<Hash>(children.data(), pairs, parents.data());
+        benchmark::consume(parents.back());
+    });
+    benchmark::report(name + " hash_pairs", size, t / pairs);
+}
+
+int main() {
+    run<hashes::sha2<256>>("sha2<256>");
+    run<hashes::keccak_1600<256>>("keccak_1600<256>");
+    run<hashes::sha3<256>>("sha3<256>");
+    run<hashes::blake2b<256>>("blake2b<256>");
+
+    return 0;
+}
@@ -0,0 +1,94 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+// Hashing the output of a CPU-bound source (standing in for a decompressor) serially, read-then-hash,
+// and through hash_pipeline, which overlaps producing and hashing on two threads.
+//---------------------------------------------------------------------------//
+
+#include <string>
+#include <vector>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/hash_pipeline.hpp>
+
+#include <nil/crypto3/hash/blake2b.hpp>
+#include <nil/crypto3/hash/sha2.hpp>
+
+#include "benchmark.hpp"
+
+using namespace nil::crypto3;
+
+struct generator {
+    explicit generator(std::size_t size) : left(size), x(0x9e3779b9) {
+    }
+
+    std::ptrdiff_t operator()(std::uint8_t *p, std::size_t n) {
+        n = std::min(n, left);
+        for (std::size_t i = 0; i != n; ++i) {
+            x ^= x << 13;
+            x ^= x >> 17;
+            x ^= x << 5;
+            p[i] = static_cast<std::uint8_t>(x);
+        }
+        left -= n;
+        return n;
+    }
+
+    std::size_t left;
+    std::uint32_t x;
+};
+
+template<typename Hash>
+void run(const std::string &name, std::size_t size) {
+    const std::size_t buffer_octets = 1 << 20;
+
+    double t = benchmark::measure([&]() {
+        generator source(size);
+        std::vector<std::uint8_t> buffer(buffer_octets);
+        accumulator_set<Hash> acc;
+        for (std::ptrdiff_t n; (n = source(buffer.data(), buffer.size())) > 0;) {
+            hash<Hash>(buffer.begin(), buffer.begin() + n, acc);
+        }
+        typename Hash::digest_type d = accumulators::extract::hash<Hash>(acc);
+        benchmark::consume(d);
+    });
+    benchmark::report(name + " serial", size, t);
+
+    for (std::size_t buffers : {2, 4, 8}) {
+        hashes::hash_pipeline<Hash> pipeline(buffers, buffer_octets);
+        t = benchmark::measure([&]() {
+            typename Hash::digest_type d;
+            pipeline(generator(size), d);
+            benchmark::consume(d);
+        });
+        benchmark::report(name + " pipeline, " + std::to_string(buffers) + " buffers", size, t);
+    }
+}
+
+int main() {
+    run<hashes::sha2<256>>("sha2<256>", 64 << 20);
+    run<hashes::blake2b<512>>("blake2b<512>", 64 << 20);
+
+    return 0;
+}
@@ -0,0 +1,86 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// Per-message cost of the plain hasher next to the accumulator based entry points.
+//---------------------------------------------------------------------------//
+
+#include <string>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/hasher.hpp>
+
+#include <nil/crypto3/hash/blake2b.hpp>
+#include <nil/crypto3/hash/keccak.hpp>
+#include <nil/crypto3/hash/sha2.hpp>
+#include <nil/crypto3/hash/sha3.hpp>
+
+#include "benchmark.hpp"
+
+using namespace nil::crypto3;
+
+template<typename Hash>
+void run(const std::string &name, std::size_t size) {
+    const std::size_t messages = 10000;
+    std::vector<std::uint8_t> m = benchmark::make_input(size);
+    std::string suffix = " " + std::to_string(size) + "B";
+
+    double t = benchmark::measure([&]() {
+        for (std::size_t i = 0; i != messages; ++i) {
+            typename Hash::digest_type d = hash<Hash>(m);
+            benchmark::consume(d);
+        }
+    });
+    benchmark::report(name + " hash<>()" + suffix, size, t / messages);
+
+    t = benchmark::measure([&]() {
+        for (std::size_t i = 0; i != messages; ++i) {
+            accumulator_set<Hash> acc;
+            hash<Hash>(m, acc);
+            typename Hash::digest_type d = accumulators::extract::hash<Hash>(acc);
+            benchmark::consume(d);
+        }
+    });
+    benchmark::report(name + " accumulator_set" + suffix, size, t / messages);
+
+    hashes::hasher<Hash> h;
+    t = benchmark::measure([&]() {
+        for (std::size_t i = 0; i != messages; ++i) {
+            typename Hash::digest_type d = h.update(m).finalize();
+            benchmark::consume(d);
+        }
+    });
+    benchmark::report(name + " hasher" + suffix, size, t / messages);
+}
+
+int main() {
+    for (std::size_t size : {0, 64, 1024}) {
+        run<hashes::sha2<256>>("sha2<256>", size);
+        run<hashes::sha2<512>>("sha2<512>", size);
+        run<hashes::sha2<256, 512>>("sha2<256, 512>", size);
+        run<hashes::keccak_1600<256>>("keccak_1600<256>", size);
+        run<hashes::sha3<256>>("sha3<256>", size);
+        run<hashes::blake2b<512>>("blake2b<512>", size);
+    }
+
+    return 0;
+}
@@ -0,0 +1,95 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+// Hashing batches of independent short messages one at a time versus interleaved across SIMD lanes.
+//---------------------------------------------------------------------------//
+
+#include <string>
+#include <vector>
+
+#include <nil/crypto3/hash/hasher.hpp>
+#include <nil/crypto3/hash/multi_buffer.hpp>
+
+#include <nil/crypto3/hash/sha2.hpp>
+
+#include "benchmark.hpp"
+
+using namespace nil::crypto3;
+
+template<typename Kernel>
+void run_kernel(const std::string &name, const std::vector<const std::uint8_t *> &pointers,
+                const std::vector<std::size_t> &sizes, std::size_t size) {
+    if (!Kernel::supported()) {
+        return;
+    }
+
+    std::vector<hashes::sha2<256>::digest_type> digests(pointers.size());
+    double t = benchmark::measure([&]() {
+        hashes::detail::sha2_256_multi_buffer<256>::process<Kernel>(pointers.data(), sizes.data(), pointers.size(),
+                                                                    digests.data());
+        benchmark::consume(digests.back());
+    });
+    benchmark::report(name, size, t / pointers.size());
+}
+
+void run(std::size_t size) {
+    const std::size_t messages = 4096;
+
+    std::vector<std::vector<std::uint8_t>> input;
+    std::vector<const std::uint8_t *> pointers;
+    std::vector<std::size_t> sizes;
+    for (std::size_t i = 0; i != messages; ++i) {
+        input.push_back(benchmark::make_input(size));
+    }
+    for (const std::vector<std::uint8_t> &m : input) {
+        pointers.push_back(m.data());
+        sizes.push_back(m.size());
+    }
+
+    const std::string suffix = " sha2<256>, " + std::to_string(size) + " bytes";
+
+    hashes::hasher<hashes::sha2<256>> h;
+    double t = benchmark::measure([&]() {
+        for (const std::vector<std::uint8_t> &m : input) {
+            hashes::sha2<256>::digest_type d = h.update(m).finalize();
+            benchmark::consume(d);
+        }
+    });
+    benchmark::report("hasher" + suffix, size, t / messages);
+
+    run_kernel<hashes::detail::sha2_256_scalar_lanes>("scalar lanes" + suffix, pointers, sizes, size);
+#ifdef CRYPTO3_HAS_X86_INTRINSICS
+    run_kernel<hashes::detail::sha2_256_avx2_lanes>("avx2 lanes" + suffix, pointers, sizes, size);
+    run_kernel<hashes::detail::sha2_256_avx512_lanes>("avx512 lanes" + suffix, pointers, sizes, size);
+#endif
+}
+
+int main() {
+    run(32);
+    run(64);
+    run(256);
+    run(1024);
+
+    return 0;
+}
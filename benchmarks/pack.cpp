@@ -0,0 +1,146 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// Packing through pack() against the element-wise imploder and exploder: octet <-> 32/64-bit word
+// conversions and packs whose input and output share the host memory layout.
+//---------------------------------------------------------------------------//
+
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <nil/crypto3/detail/pack.hpp>
+
+#include "benchmark.hpp"
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::stream_endian;
+
+template<typename InputEndianness, typename OutputEndianness, typename InputType, typename OutputType>
+void run_implode(const std::string &name, std::size_t size) {
+    constexpr std::size_t input_bits = sizeof(InputType) * CHAR_BIT;
+    constexpr std::size_t output_bits = sizeof(OutputType) * CHAR_BIT;
+    typedef detail::imploder<InputEndianness, OutputEndianness, input_bits, output_bits> imploder_type;
+
+    const std::size_t iterations = (1 << 20) / size;
+    std::vector<std::uint8_t> bytes = benchmark::make_input(size);
+    std::vector<InputType> in(size / sizeof(InputType));
+    std::memcpy(in.data(), bytes.data(), size);
+    std::vector<OutputType> out(size / sizeof(OutputType));
+
+    double t = benchmark::measure([&]() {
+        for (std::size_t i = 0; i != iterations; ++i) {
+            typename std::vector<InputType>::const_iterator it = in.begin();
+            for (OutputType &w : out) {
+                w = OutputType();
+                imploder_type::implode(it, w);
+            }
+            benchmark::consume(std::array<OutputType, 1> {{out.back()}});
+        }
+    });
+    benchmark::report(name + " imploder, " + std::to_string(size) + " bytes", size, t / iterations);
+
+    t = benchmark::measure([&]() {
+        for (std::size_t i = 0; i != iterations; ++i) {
+            detail::pack<InputEndianness, OutputEndianness, input_bits, output_bits>(in.begin(), in.end(),
+                                                                                     out.begin());
+            benchmark::consume(std::array<OutputType, 1> {{out.back()}});
+        }
+    });
+    benchmark::report(name + " pack, " + std::to_string(size) + " bytes", size, t / iterations);
+}
+
+template<typename InputEndianness, typename OutputEndianness, typename InputType, typename OutputType>
+void run_explode(const std::string &name, std::size_t size) {
+    constexpr std::size_t input_bits = sizeof(InputType) * CHAR_BIT;
+    constexpr std::size_t output_bits = sizeof(OutputType) * CHAR_BIT;
+    typedef detail::exploder<InputEndianness, OutputEndianness, input_bits, output_bits> exploder_type;
+
+    const std::size_t iterations = (1 << 20) / size;
+    std::vector<std::uint8_t> bytes = benchmark::make_input(size);
+    std::vector<InputType> in(size / sizeof(InputType));
+    std::memcpy(in.data(), bytes.data(), size);
+    std::vector<OutputType> out(size / sizeof(OutputType));
+
+    double t = benchmark::measure([&]() {
+        for (std::size_t i = 0; i != iterations; ++i) {
+            typename std::vector<OutputType>::iterator it = out.begin();
+            for (InputType w : in) {
+                exploder_type::explode(w, it);
+            }
+            benchmark::consume(std::array<OutputType, 1> {{out.back()}});
+        }
+    });
+    benchmark::report(name + " exploder, " + std::to_string(size) + " bytes", size, t / iterations);
+
+    t = benchmark::measure([&]() {
+        for (std::size_t i = 0; i != iterations; ++i) {
+            detail::pack<InputEndianness, OutputEndianness, input_bits, output_bits>(in.begin(), in.end(),
+                                                                                     out.begin());
+            benchmark::consume(std::array<OutputType, 1> {{out.back()}});
+        }
+    });
+    benchmark::report(name + " pack, " + std::to_string(size) + " bytes", size, t / iterations);
+}
+
+int main() {
+#if !defined(CRYPTO3_DISABLE_CPU_EXTENSIONS) && defined(__AVX2__)
+    std::printf("octet reversal: avx2\n");
+#elif !defined(CRYPTO3_DISABLE_CPU_EXTENSIONS) && defined(__SSSE3__)
+    std::printf("octet reversal: ssse3\n");
+#else
+    std::printf("octet reversal: bswap\n");
+#endif
+
+#if defined(BOOST_ENDIAN_LITTLE_BYTE_AVAILABLE)
+    typedef little_octet_big_bit host_endianness;
+#else
+    typedef big_octet_big_bit host_endianness;
+#endif
+
+    for (std::size_t size : {64, 16384}) {
+        run_implode<host_endianness, big_octet_big_bit, std::uint8_t, std::uint32_t>(
+            "octets -> big-endian 32-bit words", size);
+        run_implode<host_endianness, big_octet_big_bit, std::uint8_t, std::uint64_t>(
+            "octets -> big-endian 64-bit words", size);
+        run_implode<host_endianness, little_octet_big_bit, std::uint8_t, std::uint32_t>(
+            "octets -> little-endian 32-bit words", size);
+        run_explode<big_octet_big_bit, host_endianness, std::uint32_t, std::uint8_t>(
+            "big-endian 32-bit words -> octets", size);
+        run_explode<big_octet_big_bit, host_endianness, std::uint64_t, std::uint8_t>(
+            "big-endian 64-bit words -> octets", size);
+        run_explode<little_octet_big_bit, host_endianness, std::uint64_t, std::uint8_t>(
+            "little-endian 64-bit words -> octets", size);
+
+        run_implode<host_endianness, host_endianness, std::uint16_t, std::uint32_t>(
+            "host 16-bit -> host 32-bit words", size);
+        run_implode<host_endianness, host_endianness, std::uint32_t, std::uint64_t>(
+            "host 32-bit -> host 64-bit words", size);
+        run_explode<host_endianness, host_endianness, std::uint64_t, std::uint16_t>(
+            "host 64-bit -> host 16-bit words", size);
+    }
+
+    return 0;
+}
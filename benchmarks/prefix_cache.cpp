@@ -0,0 +1,92 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// Hashing 64-byte messages behind a shared 100-byte prefix, with and without the midstate cache.
+//---------------------------------------------------------------------------//
+
+#include <string>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/hasher.hpp>
+#include <nil/crypto3/hash/prefix_cache.hpp>
+
+#include <nil/crypto3/hash/blake2b.hpp>
+#include <nil/crypto3/hash/keccak.hpp>
+#include <nil/crypto3/hash/ripemd.hpp>
+#include <nil/crypto3/hash/sha2.hpp>
+#include <nil/crypto3/hash/sha3.hpp>
+
+#include "benchmark.hpp"
+
+using namespace nil::crypto3;
+
+template<typename Hash>
+void run(const std::string &name) {
+    const std::size_t messages = 10000;
+    const std::size_t prefix_size = 100, message_size = 64;
+
+    std::vector<std::uint8_t> input = benchmark::make_input(prefix_size + message_size);
+    std::vector<std::uint8_t> prefix(input.begin(), input.begin() + prefix_size);
+    std::vector<std::uint8_t> message(input.begin() + prefix_size, input.end());
+
+    double t = benchmark::measure([&]() {
+        for (std::size_t i = 0; i != messages; ++i) {
+            accumulator_set<Hash> acc;
+            hash<Hash>(prefix, acc);
+            hash<Hash>(message, acc);
+            typename Hash::digest_type d = accumulators::extract::hash<Hash>(acc);
+            benchmark::consume(d);
+        }
+    });
+    benchmark::report(name + " accumulator_set, prefix rehashed", message_size, t / messages);
+
+    hashes::hasher<Hash> h;
+    t = benchmark::measure([&]() {
+        for (std::size_t i = 0; i != messages; ++i) {
+            typename Hash::digest_type d = h.update(prefix).update(message).finalize();
+            benchmark::consume(d);
+        }
+    });
+    benchmark::report(name + " hasher, prefix rehashed", message_size, t / messages);
+
+    hashes::prefix_cache<Hash> cache(prefix);
+    t = benchmark::measure([&]() {
+        for (std::size_t i = 0; i != messages; ++i) {
+            cache.restore(h);
+            typename Hash::digest_type d = h.update(message).finalize();
+            benchmark::consume(d);
+        }
+    });
+    benchmark::report(name + " prefix_cache", message_size, t / messages);
+}
+
+int main() {
+    run<hashes::sha2<256>>("sha2<256>");
+    run<hashes::sha2<512>>("sha2<512>");
+    run<hashes::ripemd160>("ripemd160");
+    run<hashes::keccak_1600<256>>("keccak_1600<256>");
+    run<hashes::sha3<256>>("sha3<256>");
+    run<hashes::blake2b<512>>("blake2b<512>");
+
+    return 0;
+}
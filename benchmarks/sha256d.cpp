@@ -0,0 +1,96 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// Double SHA-256 of 80-byte block headers: sha2<256> applied twice, with the digest repacked into a second
+// message, versus sha256d finishing on the state words; one at a time and across SIMD lanes.
+//---------------------------------------------------------------------------//
+
+#include <string>
+#include <vector>
+
+#include <nil/crypto3/hash/hasher.hpp>
+#include <nil/crypto3/hash/multi_buffer.hpp>
+
+#include <nil/crypto3/hash/sha2.hpp>
+#include <nil/crypto3/hash/sha256d.hpp>
+
+#include "benchmark.hpp"
+
+using namespace nil::crypto3;
+
+int main() {
+    const std::size_t size = 80, messages = 4096;
+
+    std::vector<std::vector<std::uint8_t>> input;
+    std::vector<const std::uint8_t *> pointers;
+    std::vector<std::size_t> sizes;
+    for (std::size_t i = 0; i != messages; ++i) {
+        input.push_back(benchmark::make_input(size));
+        input.back()[0] = static_cast<std::uint8_t>(i);
+    }
+    for (const std::vector<std::uint8_t> &m : input) {
+        pointers.push_back(m.data());
+        sizes.push_back(m.size());
+    }
+
+    hashes::hasher<hashes::sha2<256>> h;
+    double t = benchmark::measure([&]() {
+        for (const std::vector<std::uint8_t> &m : input) {
+            hashes::sha2<256>::digest_type d = h.update(m).finalize();
+            d = h.update(d).finalize();
+            benchmark::consume(d);
+        }
+    });
+    benchmark::report("hasher sha2<256> twice", size, t / messages);
+
+    hashes::hasher<hashes::sha256d> hd;
+    t = benchmark::measure([&]() {
+        for (const std::vector<std::uint8_t> &m : input) {
+            hashes::sha256d::digest_type d = hd.update(m).finalize();
+            benchmark::consume(d);
+        }
+    });
+    benchmark::report("hasher sha256d", size, t / messages);
+
+    std::vector<hashes::sha2<256>::digest_type> first(messages), digests(messages);
+    std::vector<const std::uint8_t *> first_pointers;
+    for (const hashes::sha2<256>::digest_type &d : first) {
+        first_pointers.push_back(d.data());
+    }
+    const std::vector<std::size_t> first_sizes(messages, first[0].size());
+    t = benchmark::measure([&]() {
+        hashes::multi_buffer<hashes::sha2<256>>::process(pointers.data(), sizes.data(), messages, first.data());
+        hashes::multi_buffer<hashes::sha2<256>>::process(first_pointers.data(), first_sizes.data(), messages,
+                                                         digests.data());
+        benchmark::consume(digests.back());
+    });
+    benchmark::report("multi_buffer sha2<256> twice", size, t / messages);
+
+    t = benchmark::measure([&]() {
+        hashes::multi_buffer<hashes::sha256d>::process(pointers.data(), sizes.data(), messages, digests.data());
+        benchmark::consume(digests.back());
+    });
+    benchmark::report("multi_buffer sha256d", size, t / messages);
+
+    return 0;
+}
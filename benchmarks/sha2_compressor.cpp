@@ -0,0 +1,84 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// SHA-2 compression of the portable paths: shacal2 with davies_meyer_compressor, which expands the whole key
+// schedule before the rounds, against sha2_compressor with its rolling 16-word schedule. For SHA-512 also the
+// AVX2 kernel expanding the schedule of two blocks at a time, when the CPU has AVX2.
+//---------------------------------------------------------------------------//
+
+#include <string>
+#include <vector>
+
+#include <nil/crypto3/block/shacal2.hpp>
+
+#include <nil/crypto3/hash/detail/davies_meyer_compressor.hpp>
+#include <nil/crypto3/hash/detail/state_adder.hpp>
+#include <nil/crypto3/hash/detail/sha2/sha2_compressor.hpp>
+#include <nil/crypto3/hash/detail/sha2/sha2_512_avx2.hpp>
+
+#include "benchmark.hpp"
+
+using namespace nil::crypto3;
+
+template<typename Compressor>
+void run(const std::string &name) {
+    typedef typename Compressor::word_type word_type;
+    constexpr static const std::size_t blocks = 256;
+
+    std::vector<word_type> input(Compressor::block_words * blocks);
+    for (std::size_t i = 0; i != input.size(); ++i) {
+        input[i] = static_cast<word_type>(UINT64_C(0x9e3779b97f4a7c15) * (i + 1));
+    }
+    typename Compressor::state_type state = {};
+
+    double t = benchmark::measure([&]() {
+        Compressor::process_blocks(state, input.data(), blocks);
+        benchmark::consume(state);
+    });
+    benchmark::report(name, Compressor::block_bits / 8, t / blocks);
+}
+
+#ifdef CRYPTO3_HAS_X86_INTRINSICS
+/*!
+ * @brief sha2_512_avx2 with the compressor interface run() uses.
+ */
+struct sha2_512_avx2_compressor : public hashes::detail::sha2_compressor<512> {
+    static void process_blocks(state_type &state, const word_type *blocks, std::size_t n) {
+        hashes::detail::sha2_512_avx2::process_blocks(state.data(), blocks, n);
+    }
+};
+#endif
+
+int main() {
+    run<hashes::davies_meyer_compressor<block::shacal2<256>, hashes::detail::state_adder>>("SHA-256 shacal2");
+    run<hashes::detail::sha2_compressor<256>>("SHA-256 sha2_compressor");
+    run<hashes::davies_meyer_compressor<block::shacal2<512>, hashes::detail::state_adder>>("SHA-512 shacal2");
+    run<hashes::detail::sha2_compressor<512>>("SHA-512 sha2_compressor");
+#ifdef CRYPTO3_HAS_X86_INTRINSICS
+    if (hashes::detail::sha2_512_avx2::supported()) {
+        run<sha2_512_avx2_compressor>("SHA-512 sha2_512_avx2");
+    }
+#endif
+
+    return 0;
+}
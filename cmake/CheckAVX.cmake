@@ -33,6 +33,22 @@ set(AVX2_CODE "
   }
 ")
 
+set(SHA_CODE "
+  #include <immintrin.h>
+
+  __attribute__((target(\"sha,sse4.1\"))) int sha(__m128i a)
+  {
+    a = _mm_sha256rnds2_epu32(a, a, a);
+    a = _mm_sha1rnds4_epu32(a, a, 0);
+    return _mm_extract_epi32(a, 0);
+  }
+
+  int main()
+  {
+    return 0;
+  }
+")
+
 macro(check_avx_lang lang type flags)
     set(__FLAG_I 1)
     set(CMAKE_REQUIRED_FLAGS_SAVE ${CMAKE_REQUIRED_FLAGS})
@@ -68,4 +84,7 @@ macro(check_avx)
 
     check_avx_lang(CXX "AVX" " ;-mavx;/arch:AVX")
     check_avx_lang(CXX "AVX2" " ;-mavx2 -mfma;/arch:AVX2")
+
+    # SHA extensions kernels are compiled with target attributes, so the baseline flags are enough
+    check_avx_lang(CXX "SHA" " ")
 endmacro()
\ No newline at end of file
@@ -40,41 +40,41 @@ namespace nil {
                 constexpr static const std::size_t word_bits = WordBits;
                 typedef typename boost::uint_t<word_bits>::exact word_type;
 
-                static inline word_type shr(word_type x, std::size_t n) {
+                constexpr static inline word_type shr(word_type x, std::size_t n) {
                     return x >> n;
                 }
 
                 template<std::size_t n>
-                static inline word_type shr(word_type x) {
+                constexpr static inline word_type shr(word_type x) {
                     BOOST_STATIC_ASSERT(n < word_bits);
                     return x >> n;
                 }
 
-                static inline word_type shl(word_type x, std::size_t n) {
+                constexpr static inline word_type shl(word_type x, std::size_t n) {
                     return x << n;
                 }
 
                 template<std::size_t n>
-                static inline word_type shl(word_type x) {
+                constexpr static inline word_type shl(word_type x) {
                     BOOST_STATIC_ASSERT(n < word_bits);
                     return x << n;
                 }
 
-                static inline word_type rotr(word_type x, std::size_t n) {
+                constexpr static inline word_type rotr(word_type x, std::size_t n) {
                     return shr(x, n) | shl(x, word_bits - n);
                 }
 
                 template<std::size_t n>
-                static inline word_type rotr(word_type x) {
+                constexpr static inline word_type rotr(word_type x) {
                     return shr<n>(x) | shl<word_bits - n>(x);
                 }
 
-                static inline word_type rotl(word_type x, std::size_t n) {
+                constexpr static inline word_type rotl(word_type x, std::size_t n) {
                     return shl(x, n) | shr(x, word_bits - n);
                 }
 
                 template<std::size_t n>
-                static inline word_type rotl(word_type x) {
+                constexpr static inline word_type rotl(word_type x) {
                     return shl<n>(x) | shr<word_bits - n>(x);
                 }
             };
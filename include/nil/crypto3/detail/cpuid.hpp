@@ -0,0 +1,133 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_DETAIL_CPUID_HPP
+#define CRYPTO3_DETAIL_CPUID_HPP
+
+#include <cstdint>
+
+#include <nil/crypto3/detail/config.hpp>
+
+// CRYPTO3_HAS_X86_INTRINSICS is defined when x86 SIMD kernels can be compiled with per-function target
+// attributes, i.e. without raising the baseline instruction set of the whole translation unit. Define
+// CRYPTO3_DISABLE_CPU_EXTENSIONS to build the portable code paths only.
+#if !defined(CRYPTO3_DISABLE_CPU_EXTENSIONS) && defined(BOOST_ATTRIBUTE_TARGET) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define CRYPTO3_HAS_X86_INTRINSICS
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
+// CRYPTO3_HAS_SHA_NI is defined when the SHA extensions kernels are compiled. Define CRYPTO3_DISABLE_SHA_NI for
+// compilers without the SHA intrinsics.
+#if defined(CRYPTO3_HAS_X86_INTRINSICS) && !defined(CRYPTO3_DISABLE_SHA_NI)
+#define CRYPTO3_HAS_SHA_NI
+#endif
+
+namespace nil {
+    namespace crypto3 {
+        namespace detail {
+            /*!
+             * @brief Instruction set extensions available at runtime. Features which need operating system
+             * support for the extended register state (AVX, AVX-512) are only reported when it is enabled.
+             */
+            class cpuid {
+            public:
+                static bool has_ssse3() {
+                    return instance().ssse3;
+                }
+
+                static bool has_sse41() {
+                    return instance().sse41;
+                }
+
+                static bool has_avx2() {
+                    return instance().avx2;
+                }
+
+                static bool has_avx512f() {
+                    return instance().avx512f;
+                }
+
+                static bool has_avx512bw() {
+                    return instance().avx512bw;
+                }
+
+                static bool has_sha() {
+                    return instance().sha;
+                }
+
+            protected:
+                cpuid() : ssse3(false), sse41(false), avx2(false), avx512f(false), avx512bw(false), sha(false) {
+#ifdef CRYPTO3_HAS_X86_INTRINSICS
+                    unsigned int eax, ebx, ecx, edx;
+                    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+                        return;
+                    }
+
+                    ssse3 = ecx & (1U << 9);
+                    sse41 = ecx & (1U << 19);
+
+                    bool osxsave = ecx & (1U << 27);
+                    std::uint64_t xcr0 = osxsave ? xgetbv() : 0;
+                    bool ymm_enabled = (xcr0 & 0x06) == 0x06;
+                    bool zmm_enabled = (xcr0 & 0xe6) == 0xe6;
+
+                    if (__get_cpuid_max(0, nullptr) < 7) {
+                        return;
+                    }
+                    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+
+                    avx2 = ymm_enabled && (ebx & (1U << 5));
+                    avx512f = zmm_enabled && (ebx & (1U << 16));
+                    avx512bw = avx512f && (ebx & (1U << 30));
+                    sha = ebx & (1U << 29);
+#endif
+                }
+
+#ifdef CRYPTO3_HAS_X86_INTRINSICS
+                static std::uint64_t xgetbv() {
+                    std::uint32_t eax, edx;
+                    __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+                    return (static_cast<std::uint64_t>(edx) << 32) | eax;
+                }
+#endif
+
+                static const cpuid &instance() {
+                    static const cpuid features;
+                    return features;
+                }
+
+                bool ssse3;
+                bool sse41;
+                bool avx2;
+                bool avx512f;
+                bool avx512bw;
+                bool sha;
+            };
+        }    // namespace detail
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_DETAIL_CPUID_HPP
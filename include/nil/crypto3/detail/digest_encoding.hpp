@@ -0,0 +1,255 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_DETAIL_DIGEST_ENCODING_HPP
+#define CRYPTO3_DETAIL_DIGEST_ENCODING_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// As with octet_reverser, the vector kernels are chosen from the instruction set the translation unit is
+// compiled for (e.g. -mssse3 or -mavx2).
+#if !defined(CRYPTO3_DISABLE_CPU_EXTENSIONS) && (defined(__SSSE3__) || defined(__AVX2__))
+#include <immintrin.h>
+#endif
+
+namespace nil {
+    namespace crypto3 {
+        namespace detail {
+
+            constexpr inline std::array<std::uint8_t, 256> make_hex_digit_values() {
+                std::array<std::uint8_t, 256> r = {};
+                for (unsigned u = 0; u != r.size(); ++u) {
+                    r[u] = u - '0' < 10 ? static_cast<std::uint8_t>(u - '0') :
+                           (u | 0x20) - 'a' < 6 ? static_cast<std::uint8_t>((u | 0x20) - 'a' + 10) :
+                                                  std::uint8_t(0xFF);
+                }
+                return r;
+            }
+
+            /*!
+             * @brief Lower case hexadecimal encoding of octet buffers and validated decoding of either case.
+             * Output is written to caller provided memory, without a terminating null character.
+             */
+            struct hex_encoding {
+                constexpr static inline std::size_t encoded_size(std::size_t octets) {
+                    return octets * 2;
+                }
+
+                typedef std::array<std::uint8_t, 256> digit_values_type;
+
+                /*!
+                 * @brief Value of every character as a hexadecimal digit, 0xFF for those which are not one. A
+                 * table rather than range checks, as the latter branch unpredictably on digest text.
+                 */
+                constexpr static const digit_values_type digit_values = make_hex_digit_values();
+
+                /*!
+                 * @return Value of the hexadecimal digit c, or 0xFF if c is not one
+                 */
+                constexpr static inline std::uint8_t digit_value(char c) {
+                    return digit_values[static_cast<unsigned char>(c)];
+                }
+
+                /*!
+                 * @brief Writes encoded_size(octets) characters to out.
+                 * @return End of the written characters
+                 */
+                inline static char *encode(const std::uint8_t *in, std::size_t octets, char *out) {
+                    std::size_t i = 0;
+#if !defined(CRYPTO3_DISABLE_CPU_EXTENSIONS) && defined(__AVX2__)
+                    const __m256i digits256 = _mm256_broadcastsi128_si256(digits());
+                    const __m256i low256 = _mm256_set1_epi8(0x0F);
+                    for (; i + 32 <= octets; i += 32) {
+                        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + i));
+                        __m256i hi = _mm256_shuffle_epi8(digits256, _mm256_and_si256(_mm256_srli_epi16(v, 4), low256));
+                        __m256i lo = _mm256_shuffle_epi8(digits256, _mm256_and_si256(v, low256));
+                        // Interleaving works within 128-bit lanes, so the halves are put back in order after it
+                        __m256i a = _mm256_unpacklo_epi8(hi, lo);
+                        __m256i b = _mm256_unpackhi_epi8(hi, lo);
+                        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + 2 * i),
+                                            _mm256_permute2x128_si256(a, b, 0x20));
+                        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + 2 * i + 32),
+                                            _mm256_permute2x128_si256(a, b, 0x31));
+                    }
+#endif
+#if !defined(CRYPTO3_DISABLE_CPU_EXTENSIONS) && (defined(__SSSE3__) || defined(__AVX2__))
+                    const __m128i digits128 = digits();
+                    const __m128i low128 = _mm_set1_epi8(0x0F);
+                    for (; i + 16 <= octets; i += 16) {
+                        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+                        __m128i hi = _mm_shuffle_epi8(digits128, _mm_and_si128(_mm_srli_epi16(v, 4), low128));
+                        __m128i lo = _mm_shuffle_epi8(digits128, _mm_and_si128(v, low128));
+                        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 2 * i), _mm_unpacklo_epi8(hi, lo));
+                        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 2 * i + 16), _mm_unpackhi_epi8(hi, lo));
+                    }
+#endif
+                    for (; i < octets; ++i) {
+                        out[2 * i] = "0123456789abcdef"[in[i] >> 4];
+                        out[2 * i + 1] = "0123456789abcdef"[in[i] & 0x0F];
+                    }
+                    return out + 2 * i;
+                }
+
+                /*!
+                 * @brief Reads encoded_size(octets) hexadecimal digits of either case from in.
+                 * @return false if any of them is not a hexadecimal digit, in which case out is left partially
+                 * written
+                 */
+                inline static bool decode(const char *in, std::size_t octets, std::uint8_t *out) {
+                    std::size_t i = 0;
+#if !defined(CRYPTO3_DISABLE_CPU_EXTENSIONS) && defined(__AVX2__)
+                    for (; i + 16 <= octets; i += 16) {
+                        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + 2 * i));
+                        __m256i digit = _mm256_sub_epi8(v, _mm256_set1_epi8('0'));
+                        __m256i alpha = _mm256_sub_epi8(_mm256_or_si256(v, _mm256_set1_epi8(0x20)),
+                                                        _mm256_set1_epi8('a'));
+                        __m256i is_digit = _mm256_cmpeq_epi8(_mm256_min_epu8(digit, _mm256_set1_epi8(9)), digit);
+                        __m256i is_alpha = _mm256_cmpeq_epi8(_mm256_min_epu8(alpha, _mm256_set1_epi8(5)), alpha);
+                        if (static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_or_si256(is_digit, is_alpha))) !=
+                            0xFFFFFFFFU) {
+                            return false;
+                        }
+                        __m256i nibbles =
+                            _mm256_or_si256(_mm256_and_si256(is_digit, digit),
+                                            _mm256_and_si256(is_alpha, _mm256_add_epi8(alpha, _mm256_set1_epi8(10))));
+                        // 16 * high + low for every pair of digits, then narrowed to octets per 128-bit lane
+                        __m256i octets16 = _mm256_maddubs_epi16(nibbles, _mm256_set1_epi16(0x0110));
+                        __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(octets16, octets16), 0x08);
+                        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), _mm256_castsi256_si128(packed));
+                    }
+#endif
+#if !defined(CRYPTO3_DISABLE_CPU_EXTENSIONS) && (defined(__SSSE3__) || defined(__AVX2__))
+                    for (; i + 8 <= octets; i += 8) {
+                        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + 2 * i));
+                        __m128i digit = _mm_sub_epi8(v, _mm_set1_epi8('0'));
+                        __m128i alpha = _mm_sub_epi8(_mm_or_si128(v, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+                        __m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+                        __m128i is_alpha = _mm_cmpeq_epi8(_mm_min_epu8(alpha, _mm_set1_epi8(5)), alpha);
+                        if (_mm_movemask_epi8(_mm_or_si128(is_digit, is_alpha)) != 0xFFFF) {
+                            return false;
+                        }
+                        __m128i nibbles = _mm_or_si128(_mm_and_si128(is_digit, digit),
+                                                       _mm_and_si128(is_alpha, _mm_add_epi8(alpha, _mm_set1_epi8(10))));
+                        __m128i octets16 = _mm_maddubs_epi16(nibbles, _mm_set1_epi16(0x0110));
+                        _mm_storel_epi64(reinterpret_cast<__m128i *>(out + i), _mm_packus_epi16(octets16, octets16));
+                    }
+#endif
+                    for (; i < octets; ++i) {
+                        const std::uint8_t hi = digit_value(in[2 * i]), lo = digit_value(in[2 * i + 1]);
+                        if ((hi | lo) == 0xFF) {
+                            return false;
+                        }
+                        out[i] = static_cast<std::uint8_t>((hi << 4) | lo);
+                    }
+                    return true;
+                }
+
+            private:
+#if !defined(CRYPTO3_DISABLE_CPU_EXTENSIONS) && (defined(__SSSE3__) || defined(__AVX2__))
+                inline static __m128i digits() {
+                    return _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e',
+                                         'f');
+                }
+#endif
+            };
+
+            constexpr typename hex_encoding::digit_values_type const hex_encoding::digit_values;
+
+            /*!
+             * @brief Unpadded base64url (RFC 4648, section 5) encoding of octet buffers.
+             */
+            struct base64url_encoding {
+                constexpr static inline std::size_t encoded_size(std::size_t octets) {
+                    return (octets * 8 + 5) / 6;
+                }
+
+                /*!
+                 * @brief Writes encoded_size(octets) characters to out.
+                 * @return End of the written characters
+                 */
+                inline static char *encode(const std::uint8_t *in, std::size_t octets, char *out) {
+                    const char *alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+                    std::size_t i = 0;
+                    for (; i + 3 <= octets; i += 3) {
+                        const std::uint32_t w = (std::uint32_t(in[i]) << 16) | (std::uint32_t(in[i + 1]) << 8) |
+                                                std::uint32_t(in[i + 2]);
+                        *out++ = alphabet[(w >> 18) & 0x3F];
+                        *out++ = alphabet[(w >> 12) & 0x3F];
+                        *out++ = alphabet[(w >> 6) & 0x3F];
+                        *out++ = alphabet[w & 0x3F];
+                    }
+                    if (octets - i == 1) {
+                        const std::uint32_t w = std::uint32_t(in[i]) << 16;
+                        *out++ = alphabet[(w >> 18) & 0x3F];
+                        *out++ = alphabet[(w >> 12) & 0x3F];
+                    } else if (octets - i == 2) {
+                        const std::uint32_t w = (std::uint32_t(in[i]) << 16) | (std::uint32_t(in[i + 1]) << 8);
+                        *out++ = alphabet[(w >> 18) & 0x3F];
+                        *out++ = alphabet[(w >> 12) & 0x3F];
+                        *out++ = alphabet[(w >> 6) & 0x3F];
+                    }
+                    return out;
+                }
+            };
+
+            /*!
+             * @brief Unpadded base32 (RFC 4648, section 6) encoding of octet buffers.
+             */
+            struct base32_encoding {
+                constexpr static inline std::size_t encoded_size(std::size_t octets) {
+                    return (octets * 8 + 4) / 5;
+                }
+
+                /*!
+                 * @brief Writes encoded_size(octets) characters to out.
+                 * @return End of the written characters
+                 */
+                inline static char *encode(const std::uint8_t *in, std::size_t octets, char *out) {
+                    const char *alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZ234567";
+
+                    // Every 5 octets make 8 characters. The tail is zero extended and only the characters
+                    // covering its bits are written.
+                    for (std::size_t i = 0; i < octets; i += 5) {
+                        const std::size_t n = octets - i < 5 ? octets - i : 5;
+                        std::uint64_t w = 0;
+                        for (std::size_t j = 0; j != 5; ++j) {
+                            w = (w << 8) | (j < n ? in[i + j] : 0);
+                        }
+                        const std::size_t characters = (n * 8 + 4) / 5;
+                        for (std::size_t j = 0; j != characters; ++j) {
+                            *out++ = alphabet[(w >> (35 - 5 * j)) & 0x1F];
+                        }
+                    }
+                    return out;
+                }
+            };
+
+        }    // namespace detail
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_DETAIL_DIGEST_ENCODING_HPP
@@ -0,0 +1,118 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_DETAIL_OCTET_REVERSER_HPP
+#define CRYPTO3_DETAIL_OCTET_REVERSER_HPP
+
+#include <boost/config.hpp>
+#include <boost/integer.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/endian/conversion.hpp>
+
+#include <cstdint>
+#include <cstring>
+
+// The vector kernels are chosen from the instruction set the translation unit is compiled for
+// (e.g. -mssse3 or -mavx2), so no runtime dispatch happens on the packing path.
+#if !defined(CRYPTO3_DISABLE_CPU_EXTENSIONS) && (defined(__SSSE3__) || defined(__AVX2__))
+#include <immintrin.h>
+#endif
+
+namespace nil {
+    namespace crypto3 {
+        namespace detail {
+
+            /*!
+             * @brief octet_reverser copies words of WordBits bits from in to out reversing the order of
+             * octets inside every word. Both buffers are plain memory and need not be aligned. This is
+             * the memory-level operation behind converting octet sequences to big-endian words on a
+             * little-endian host (and vice versa), with in and out allowed to be either side.
+             *
+             * @ingroup reverser
+             *
+             * @tparam WordBits
+             */
+            template<std::size_t WordBits>
+            struct octet_reverser {
+                BOOST_STATIC_ASSERT(WordBits == 16 || WordBits == 32 || WordBits == 64);
+
+                constexpr static const std::size_t word_octets = WordBits / 8;
+                typedef typename boost::uint_t<WordBits>::exact word_type;
+
+                inline static void reverse(const std::uint8_t *in, std::uint8_t *out, std::size_t words) {
+                    std::size_t i = 0;
+#if !defined(CRYPTO3_DISABLE_CPU_EXTENSIONS) && (defined(__SSSE3__) || defined(__AVX2__))
+                    // Runs shorter than a vector, e.g. a single word, stay on the inline scalar loop below
+                    if (words >= 16 / word_octets) {
+                        i = reverse_vectors(in, out, words);
+                    }
+#endif
+                    for (; i < words; ++i) {
+                        word_type w;
+                        std::memcpy(&w, in + i * word_octets, word_octets);
+                        w = boost::endian::endian_reverse(w);
+                        std::memcpy(out + i * word_octets, &w, word_octets);
+                    }
+                }
+
+            private:
+#if !defined(CRYPTO3_DISABLE_CPU_EXTENSIONS) && (defined(__SSSE3__) || defined(__AVX2__))
+                /*!
+                 * @brief Reverses whole vectors of words and returns the number of words done. It is kept out
+                 * of line so that the compiler does not check the vector loads and stores against the bounds of
+                 * short caller arrays which the guard in reverse() keeps away from it.
+                 */
+                BOOST_NOINLINE static std::size_t reverse_vectors(const std::uint8_t *in, std::uint8_t *out,
+                                                                  std::size_t words) {
+                    std::size_t i = 0;
+#if defined(__AVX2__)
+                    const __m256i mask256 = _mm256_broadcastsi128_si256(shuffle_mask());
+                    for (; i + 32 / word_octets <= words; i += 32 / word_octets) {
+                        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + i * word_octets));
+                        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i * word_octets),
+                                            _mm256_shuffle_epi8(v, mask256));
+                    }
+#endif
+                    const __m128i mask128 = shuffle_mask();
+                    for (; i + 16 / word_octets <= words; i += 16 / word_octets) {
+                        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i * word_octets));
+                        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i * word_octets),
+                                         _mm_shuffle_epi8(v, mask128));
+                    }
+                    return i;
+                }
+
+                inline static __m128i shuffle_mask() {
+                    return word_octets == 8 ? _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8) :
+                           word_octets == 4 ? _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12) :
+                                              _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+                }
+#endif
+            };
+
+        }    // namespace detail
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_DETAIL_OCTET_REVERSER_HPP
@@ -31,6 +31,7 @@
 #include <nil/crypto3/detail/exploder.hpp>
 #include <nil/crypto3/detail/imploder.hpp>
 #include <nil/crypto3/detail/reverser.hpp>
+#include <nil/crypto3/detail/octet_reverser.hpp>
 #include <nil/crypto3/detail/predef.hpp>
 
 #include <boost/static_assert.hpp>
@@ -39,6 +40,7 @@
 
 #include <algorithm>
 #include <climits>
+#include <cstring>
 #include <iterator>
 #include <type_traits>
 
@@ -71,7 +73,8 @@ namespace nil {
             struct host_can_memcpy {
                 constexpr static const bool value = !(UnitBits % CHAR_BIT) && InputBits >= UnitBits &&
                                                     OutputBits >= UnitBits && sizeof(InT) * CHAR_BIT == InputBits &&
-                                                    sizeof(OutT) * CHAR_BIT == OutputBits;
+                                                    sizeof(OutT) * CHAR_BIT == OutputBits &&
+                                                    std::is_integral<InT>::value && std::is_integral<OutT>::value;
             };
 
             /*!
@@ -88,7 +91,8 @@ namespace nil {
              */
             template<typename Endianness, int InputBits, int OutputBits, typename InT, typename OutT>
             struct can_memcpy {
-                constexpr static const bool value = InputBits == OutputBits && sizeof(InT) == sizeof(OutT);
+                constexpr static const bool value = InputBits == OutputBits && sizeof(InT) == sizeof(OutT) &&
+                                                    std::is_integral<InT>::value && std::is_integral<OutT>::value;
             };
 
             template<int UnitBits, int InputBits, int OutputBits, typename InT, typename OutT>
@@ -106,13 +110,67 @@ namespace nil {
 
 #elif defined(BOOST_ENDIAN_BIG_BYTE_AVAILABLE)
             template<int UnitBits, int InputBits, int OutputBits, typename InT, typename OutT>
-            struct can_memcpy<stream_endian::big_unit_big_bit<UnitBits>, ValueBits, InT, OutT>
+            struct can_memcpy<stream_endian::big_unit_big_bit<UnitBits>, InputBits, OutputBits, InT, OutT>
                 : host_can_memcpy<UnitBits, InputBits, OutputBits, InT, OutT> { };
+
             template<int UnitBits, int InputBits, int OutputBits, typename InT, typename OutT>
-            struct can_memcpy<stream_endian::big_unit_little_bit<UnitBits>, ValueBits, InT, OutT>
-                : host_can_memcpy<UnitBits, InputBits, OutputBits, , InT, OutT> { };
+            struct can_memcpy<stream_endian::big_unit_little_bit<UnitBits>, InputBits, OutputBits, InT, OutT>
+                : host_can_memcpy<UnitBits, InputBits, OutputBits, InT, OutT> { };
 #endif
 
+            /*!
+             * @brief is_contiguous_iterator_of trait checks whether the iterator refers to contiguously
+             * stored elements of type T.
+             *
+             * @ingroup pack
+             *
+             * @tparam Iterator
+             * @tparam T
+             */
+            template<typename Iterator, typename T,
+                     bool = std::is_same<typename std::iterator_traits<Iterator>::value_type, T>::value>
+            struct is_contiguous_iterator_of : std::integral_constant<bool, is_contiguous_iterator<Iterator>::value> {
+            };
+
+            template<typename Iterator, typename T>
+            struct is_contiguous_iterator_of<Iterator, T, false> : std::false_type { };
+
+            /*!
+             * @brief can_memcpy_iterators trait checks whether packing with memcpy is possible for the given
+             * iterators, i.e. whether the representation allows it (CanMemcpy) and both iterators refer to
+             * contiguous memory.
+             *
+             * @ingroup pack
+             *
+             * @tparam CanMemcpy
+             * @tparam InputIterator
+             * @tparam InputType
+             * @tparam OutputIterator
+             * @tparam OutputType
+             */
+            template<bool CanMemcpy, typename InputIterator, typename InputType, typename OutputIterator,
+                     typename OutputType>
+            struct can_memcpy_iterators
+                : std::integral_constant<bool, CanMemcpy &&
+                                                   is_contiguous_iterator_of<InputIterator, InputType>::value &&
+                                                   is_contiguous_iterator_of<OutputIterator, OutputType>::value> { };
+
+            /*!
+             * @brief Copies octets octets from contiguous input iterated by in to contiguous output iterated by out.
+             *
+             * @ingroup pack
+             *
+             * @param in
+             * @param octets
+             * @param out
+             */
+            template<typename InputIterator, typename OutputIterator>
+            inline void pack_memcpy(InputIterator in, std::size_t octets, OutputIterator out) {
+                if (octets) {
+                    std::memcpy(&*out, &*in, octets);
+                }
+            }
+
             /*!
              * @brief Real_packer is used to transform input data divided into chunks of the bit size InputValueBits
              * represented in input endianness (InputEndianness)
@@ -160,47 +218,50 @@ namespace nil {
             template<typename Endianness, std::size_t ValueBits, typename InputType, typename OutputType>
             struct real_packer<Endianness, Endianness, ValueBits, ValueBits, InputType, OutputType, true, false,
                                false> {
+                template<typename InputIterator, typename OutputIterator>
+                struct is_memcpy
+                    : can_memcpy_iterators<can_memcpy<Endianness, ValueBits, ValueBits, InputType, OutputType>::value,
+                                           InputIterator, InputType, OutputIterator, OutputType> { };
+
                 /*!
-                 * @brief Packs n InputType elements pointed by constant pointer in
-                 * (which, hence, cannot be iterated) into OutType elements pointed by out.
-                 * This function is invoked only if memcpy call is possible.
+                 * @brief Packs in_n elements iterated by in into elements iterated by out.
+                 * Contiguous elements with the same in-memory representation are copied by memcpy.
                  *
                  * @ingroup pack
                  *
+                 * @tparam InputIterator
+                 * @tparam OutputIterator
+                 *
                  * @param in
-                 * @param n
+                 * @param in_n
                  * @param out
                  *
                  * @return
                  */
-                template<std::size_t InputValueBits, std::size_t OutputValueBits>
-                inline static typename std::enable_if<
-                    can_memcpy<Endianness, InputValueBits, OutputValueBits, InputType, OutputType>::value>::type
-                    pack_n(InputType const *in, std::size_t n, OutputType *out) {
-                    std::memcpy(out, in, n * sizeof(InputType));
+                template<typename InputIterator, typename OutputIterator>
+                inline static void pack_n(InputIterator in, std::size_t in_n, OutputIterator out) {
+                    pack_n(in, in_n, out, is_memcpy<InputIterator, OutputIterator>());
                 }
 
                 /*!
-                 * @brief Packs n InputType elements pointed by pointer in into OutType elements pointed by out.
+                 * @brief Packs in_n elements iterated by in into elements iterated by out.
                  * This function is invoked only if memcpy call is possible.
                  *
                  * @ingroup pack
                  *
                  * @param in
-                 * @param n
+                 * @param in_n
                  * @param out
                  *
                  * @return
                  */
-                template<std::size_t InputValueBits, std::size_t OutputValueBits>
-                inline static typename std::enable_if<
-                    can_memcpy<Endianness, InputValueBits, OutputValueBits, InputType, OutputType>::value>::type
-                    pack_n(InputType *in, std::size_t n, OutputType *out) {
-                    std::memcpy(out, in, n * sizeof(InputType));
+                template<typename InputIterator, typename OutputIterator>
+                inline static void pack_n(InputIterator in, std::size_t in_n, OutputIterator out, std::true_type) {
+                    pack_memcpy(in, in_n * sizeof(InputType), out);
                 }
 
                 /*!
-                 * @brief Packs in_n elements iterated by in into elements iterated by out.
+                 * @brief Packs in_n elements iterated by in into elements iterated by out element by element.
                  *
                  * @ingroup pack
                  *
@@ -214,7 +275,7 @@ namespace nil {
                  * @return
                  */
                 template<typename InputIterator, typename OutputIterator>
-                inline static void pack_n(InputIterator in, std::size_t in_n, OutputIterator out) {
+                inline static void pack_n(InputIterator in, std::size_t in_n, OutputIterator out, std::false_type) {
                     std::copy(in, in + in_n, out);
                 }
 
@@ -318,8 +379,37 @@ namespace nil {
                 typedef unit_reverser<InputEndianness, OutputEndianness, UnitBits> units_reverser;
                 typedef bit_reverser<InputEndianness, OutputEndianness, UnitBits> bits_reverser;
 
+                /*!
+                 * @brief Elements consisting of a single unit with the same bit order are left intact by
+                 * the reversers, so such elements can be copied by memcpy.
+                 */
+                constexpr static const bool is_identity =
+                    sizeof(InputType) * CHAR_BIT == UnitBits && sizeof(InputType) == sizeof(OutputType) &&
+                    std::is_integral<InputType>::value && std::is_integral<OutputType>::value &&
+                    is_same_bit<InputEndianness, OutputEndianness, UnitBits>::value;
+
+                template<typename InputIterator, typename OutputIterator>
+                struct is_memcpy
+                    : can_memcpy_iterators<is_identity, InputIterator, InputType, OutputIterator, OutputType> { };
+
                 template<typename InputIterator, typename OutputIterator>
                 inline static void pack_n(InputIterator in, std::size_t in_n, OutputIterator out) {
+                    pack_n(in, in_n, out, is_memcpy<InputIterator, OutputIterator>());
+                }
+
+                template<typename InputIterator, typename OutputIterator>
+                inline static void pack(InputIterator first, InputIterator last, OutputIterator out) {
+                    pack(first, last, out, is_memcpy<InputIterator, OutputIterator>());
+                }
+
+            private:
+                template<typename InputIterator, typename OutputIterator>
+                inline static void pack_n(InputIterator in, std::size_t in_n, OutputIterator out, std::true_type) {
+                    pack_memcpy(in, in_n * sizeof(InputType), out);
+                }
+
+                template<typename InputIterator, typename OutputIterator>
+                inline static void pack_n(InputIterator in, std::size_t in_n, OutputIterator out, std::false_type) {
 
                     std::transform(in, in + in_n, out, [](InputType const &elem) {
                         return units_reverser::reverse(bits_reverser::reverse(elem));
@@ -327,7 +417,13 @@ namespace nil {
                 }
 
                 template<typename InputIterator, typename OutputIterator>
-                inline static void pack(InputIterator first, InputIterator last, OutputIterator out) {
+                inline static void pack(InputIterator first, InputIterator last, OutputIterator out, std::true_type) {
+                    pack_memcpy(first, std::distance(first, last) * sizeof(InputType), out);
+                }
+
+                template<typename InputIterator, typename OutputIterator>
+                inline static void pack(InputIterator first, InputIterator last, OutputIterator out,
+                                        std::false_type) {
 
                     std::transform(first, last, out, [](InputType const &elem) {
                         return units_reverser::reverse(bits_reverser::reverse(elem));
@@ -362,9 +458,33 @@ namespace nil {
                                                        OutputValueBits>
                     imploder;
 
+                constexpr static const std::size_t ratio = OutputValueBits / InputValueBits;
+
+                template<typename InputIterator, typename OutputIterator>
+                struct is_memcpy
+                    : can_memcpy_iterators<SameEndianness && can_memcpy<InputEndianness, InputValueBits,
+                                                                        OutputValueBits, InputType, OutputType>::value,
+                                           InputIterator, InputType, OutputIterator, OutputType> { };
+
                 template<typename InputIterator, typename OutputIterator>
                 inline static void pack_n(InputIterator in, std::size_t in_n, OutputIterator out) {
-                    std::size_t out_n = in_n / (OutputValueBits / InputValueBits);
+                    pack_n(in, in_n, out, is_memcpy<InputIterator, OutputIterator>());
+                }
+
+                template<typename InputIterator, typename OutputIterator>
+                inline static void pack(InputIterator first, InputIterator last, OutputIterator out) {
+                    pack(first, last, out, is_memcpy<InputIterator, OutputIterator>());
+                }
+
+            private:
+                template<typename InputIterator, typename OutputIterator>
+                inline static void pack_n(InputIterator in, std::size_t in_n, OutputIterator out, std::true_type) {
+                    pack_memcpy(in, in_n / ratio * sizeof(OutputType), out);
+                }
+
+                template<typename InputIterator, typename OutputIterator>
+                inline static void pack_n(InputIterator in, std::size_t in_n, OutputIterator out, std::false_type) {
+                    std::size_t out_n = in_n / ratio;
 
                     while (out_n--) {
                         OutputType value = OutputType();
@@ -374,7 +494,16 @@ namespace nil {
                 }
 
                 template<typename InputIterator, typename OutputIterator>
-                inline static void pack(InputIterator first, InputIterator last, OutputIterator out) {
+                inline static void pack(InputIterator first, InputIterator last, OutputIterator out, std::true_type) {
+                    std::size_t out_n = std::distance(first, last) / ratio;
+
+                    pack_memcpy(first, out_n * sizeof(OutputType), out);
+                    pack(first + out_n * ratio, last, out + out_n, std::false_type());
+                }
+
+                template<typename InputIterator, typename OutputIterator>
+                inline static void pack(InputIterator first, InputIterator last, OutputIterator out,
+                                        std::false_type) {
                     while (first != last) {
                         OutputType value = OutputType();
                         imploder::implode(first, value);
@@ -410,16 +539,293 @@ namespace nil {
                                                        OutputValueBits>
                     exploder;
 
+                template<typename InputIterator, typename OutputIterator>
+                struct is_memcpy
+                    : can_memcpy_iterators<SameEndianness && can_memcpy<InputEndianness, InputValueBits,
+                                                                        OutputValueBits, InputType, OutputType>::value,
+                                           InputIterator, InputType, OutputIterator, OutputType> { };
+
                 template<typename InputIterator, typename OutputIterator>
                 inline static void pack_n(InputIterator in, std::size_t in_n, OutputIterator out) {
+                    pack_n(in, in_n, out, is_memcpy<InputIterator, OutputIterator>());
+                }
+
+                template<typename InputIterator, typename OutputIterator>
+                inline static void pack(InputIterator first, InputIterator last, OutputIterator out) {
+                    pack(first, last, out, is_memcpy<InputIterator, OutputIterator>());
+                }
+
+            private:
+                template<typename InputIterator, typename OutputIterator>
+                inline static void pack_n(InputIterator in, std::size_t in_n, OutputIterator out, std::true_type) {
+                    pack_memcpy(in, in_n * sizeof(InputType), out);
+                }
+
+                template<typename InputIterator, typename OutputIterator>
+                inline static void pack_n(InputIterator in, std::size_t in_n, OutputIterator out, std::false_type) {
                     while (in_n--) {
                         InputType const value = *in++;
                         exploder::explode(value, out);
                     }
                 }
 
+                template<typename InputIterator, typename OutputIterator>
+                inline static void pack(InputIterator first, InputIterator last, OutputIterator out, std::true_type) {
+                    pack_memcpy(first, std::distance(first, last) * sizeof(InputType), out);
+                }
+
+                template<typename InputIterator, typename OutputIterator>
+                inline static void pack(InputIterator first, InputIterator last, OutputIterator out,
+                                        std::false_type) {
+                    while (first != last) {
+                        InputType const value = *first++;
+                        exploder::explode(value, out);
+                    }
+                }
+            };
+
+            /*!
+             * @brief is_octet_big_bit trait checks whether the endianness is octet-granular with big-endian
+             * bit order inside octets, i.e. whether an octet keeps its value while being packed.
+             *
+             * @ingroup pack
+             *
+             * @tparam Endianness
+             */
+            template<typename Endianness>
+            struct is_octet_big_bit : std::false_type { };
+
+            template<>
+            struct is_octet_big_bit<stream_endian::big_octet_big_bit> : std::true_type { };
+
+            template<>
+            struct is_octet_big_bit<stream_endian::little_octet_big_bit> : std::true_type { };
+
+            /*!
+             * @brief octet_word_packing trait checks whether packing between octets and WordBits-sized words
+             * can be done directly on memory: either by a plain copy, if WordEndianness matches the host byte
+             * order, or by reversing octets inside every word otherwise.
+             *
+             * @ingroup pack
+             *
+             * @tparam OctetEndianness
+             * @tparam WordEndianness
+             * @tparam WordBits
+             * @tparam OctetType
+             * @tparam WordType
+             */
+            template<typename OctetEndianness, typename WordEndianness, std::size_t WordBits, typename OctetType,
+                     typename WordType>
+            struct octet_word_packing {
+#ifdef BOOST_ENDIAN_LITTLE_BYTE_AVAILABLE
+                constexpr static const bool reverse =
+                    std::is_same<WordEndianness, stream_endian::big_octet_big_bit>::value;
+#elif defined(BOOST_ENDIAN_BIG_BYTE_AVAILABLE)
+                constexpr static const bool reverse =
+                    std::is_same<WordEndianness, stream_endian::little_octet_big_bit>::value;
+#else
+                constexpr static const bool reverse = false;
+#endif
+
+                constexpr static const bool value =
+#if defined(BOOST_ENDIAN_LITTLE_BYTE_AVAILABLE) || defined(BOOST_ENDIAN_BIG_BYTE_AVAILABLE)
+                    CHAR_BIT == 8 && is_octet_big_bit<OctetEndianness>::value &&
+                    is_octet_big_bit<WordEndianness>::value && (WordBits == 32 || WordBits == 64) &&
+                    std::is_integral<OctetType>::value && !std::is_same<OctetType, bool>::value &&
+                    sizeof(OctetType) == 1 && std::is_integral<WordType>::value &&
+                    sizeof(WordType) * CHAR_BIT == WordBits;
+#else
+                    false;
+#endif
+
+                inline static void copy(const void *in, void *out, std::size_t words) {
+                    if (reverse) {
+                        octet_reverser<WordBits>::reverse(static_cast<const std::uint8_t *>(in),
+                                                          static_cast<std::uint8_t *>(out), words);
+                    } else {
+                        std::memcpy(out, in, words * (WordBits / 8));
+                    }
+                }
+            };
+
+            /*!
+             * @brief This real_packer deals with the case of octets imploded into 32- or 64-bit words, with
+             * both endiannesses being octet-granular. Contiguous input and output are packed directly in memory
+             * by octet_word_packing, which reverses octets with SSSE3/AVX2 shuffles where the target supports
+             * them and byte swaps otherwise, or by memcpy if can_memcpy allows it. Other cases fall back to the
+             * imploder.
+             *
+             * @ingroup pack
+             *
+             * @tparam InputEndian
+             * @tparam OutputEndian
+             * @tparam OutputValueBits
+             * @tparam InputType
+             * @tparam OutputType
+             * @tparam SameEndianness
+             */
+            template<template<int> class InputEndian, template<int> class OutputEndian, std::size_t OutputValueBits,
+                     typename InputType, typename OutputType, bool SameEndianness>
+            struct real_packer<InputEndian<8>, OutputEndian<8>, 8, OutputValueBits, InputType, OutputType,
+                               SameEndianness, true, false> {
+
+                BOOST_STATIC_ASSERT(!(OutputValueBits % 8));
+
+                typedef InputEndian<8> InputEndianness;
+                typedef OutputEndian<8> OutputEndianness;
+
+                typedef nil::crypto3::detail::imploder<InputEndianness, OutputEndianness, 8, OutputValueBits> imploder;
+                typedef octet_word_packing<InputEndianness, OutputEndianness, OutputValueBits, InputType, OutputType>
+                    packing_type;
+
+                constexpr static const std::size_t ratio = OutputValueBits / 8;
+
+                constexpr static const bool is_host_layout =
+                    SameEndianness && can_memcpy<InputEndianness, 8, OutputValueBits, InputType, OutputType>::value;
+
+                template<typename InputIterator, typename OutputIterator>
+                struct is_direct : can_memcpy_iterators<packing_type::value || is_host_layout, InputIterator, InputType,
+                                                        OutputIterator, OutputType> { };
+
+                template<typename InputIterator, typename OutputIterator>
+                inline static void pack_n(InputIterator in, std::size_t in_n, OutputIterator out) {
+                    pack_n(in, in_n, out, is_direct<InputIterator, OutputIterator>());
+                }
+
                 template<typename InputIterator, typename OutputIterator>
                 inline static void pack(InputIterator first, InputIterator last, OutputIterator out) {
+                    pack(first, last, out, is_direct<InputIterator, OutputIterator>());
+                }
+
+            private:
+                inline static void copy(const void *in, void *out, std::size_t words) {
+                    if (packing_type::value) {
+                        packing_type::copy(in, out, words);
+                    } else {
+                        std::memcpy(out, in, words * sizeof(OutputType));
+                    }
+                }
+
+                template<typename InputIterator, typename OutputIterator>
+                inline static void pack_n(InputIterator in, std::size_t in_n, OutputIterator out, std::true_type) {
+                    std::size_t out_n = in_n / ratio;
+
+                    if (out_n) {
+                        copy(&*in, &*out, out_n);
+                    }
+                }
+
+                template<typename InputIterator, typename OutputIterator>
+                inline static void pack_n(InputIterator in, std::size_t in_n, OutputIterator out, std::false_type) {
+                    std::size_t out_n = in_n / ratio;
+
+                    while (out_n--) {
+                        OutputType value = OutputType();
+                        imploder::implode(in, value);
+                        *out++ = value;
+                    }
+                }
+
+                template<typename InputIterator, typename OutputIterator>
+                inline static void pack(InputIterator first, InputIterator last, OutputIterator out, std::true_type) {
+                    std::size_t out_n = std::distance(first, last) / ratio;
+
+                    if (out_n) {
+                        copy(&*first, &*out, out_n);
+                        first += out_n * ratio;
+                        out += out_n;
+                    }
+                    pack(first, last, out, std::false_type());
+                }
+
+                template<typename InputIterator, typename OutputIterator>
+                inline static void pack(InputIterator first, InputIterator last, OutputIterator out,
+                                        std::false_type) {
+                    while (first != last) {
+                        OutputType value = OutputType();
+                        imploder::implode(first, value);
+                        *out++ = value;
+                    }
+                }
+            };
+
+            /*!
+             * @brief This real_packer deals with the case of 32- or 64-bit words exploded into octets, with
+             * both endiannesses being octet-granular. Contiguous input and output are unpacked directly in memory
+             * by octet_word_packing, or by memcpy if can_memcpy allows it. Other cases fall back to the exploder.
+             *
+             * @ingroup pack
+             *
+             * @tparam InputEndian
+             * @tparam OutputEndian
+             * @tparam InputValueBits
+             * @tparam InputType
+             * @tparam OutputType
+             * @tparam SameEndianness
+             */
+            template<template<int> class InputEndian, template<int> class OutputEndian, std::size_t InputValueBits,
+                     typename InputType, typename OutputType, bool SameEndianness>
+            struct real_packer<InputEndian<8>, OutputEndian<8>, InputValueBits, 8, InputType, OutputType,
+                               SameEndianness, false, true> {
+
+                BOOST_STATIC_ASSERT(!(InputValueBits % 8));
+
+                typedef InputEndian<8> InputEndianness;
+                typedef OutputEndian<8> OutputEndianness;
+
+                typedef nil::crypto3::detail::exploder<InputEndianness, OutputEndianness, InputValueBits, 8> exploder;
+                typedef octet_word_packing<OutputEndianness, InputEndianness, InputValueBits, OutputType, InputType>
+                    packing_type;
+
+                constexpr static const bool is_host_layout =
+                    SameEndianness && can_memcpy<InputEndianness, InputValueBits, 8, InputType, OutputType>::value;
+
+                template<typename InputIterator, typename OutputIterator>
+                struct is_direct : can_memcpy_iterators<packing_type::value || is_host_layout, InputIterator, InputType,
+                                                        OutputIterator, OutputType> { };
+
+                template<typename InputIterator, typename OutputIterator>
+                inline static void pack_n(InputIterator in, std::size_t in_n, OutputIterator out) {
+                    pack_n(in, in_n, out, is_direct<InputIterator, OutputIterator>());
+                }
+
+                template<typename InputIterator, typename OutputIterator>
+                inline static void pack(InputIterator first, InputIterator last, OutputIterator out) {
+                    pack(first, last, out, is_direct<InputIterator, OutputIterator>());
+                }
+
+            private:
+                inline static void copy(const void *in, void *out, std::size_t words) {
+                    if (packing_type::value) {
+                        packing_type::copy(in, out, words);
+                    } else {
+                        std::memcpy(out, in, words * sizeof(InputType));
+                    }
+                }
+
+                template<typename InputIterator, typename OutputIterator>
+                inline static void pack_n(InputIterator in, std::size_t in_n, OutputIterator out, std::true_type) {
+                    if (in_n) {
+                        copy(&*in, &*out, in_n);
+                    }
+                }
+
+                template<typename InputIterator, typename OutputIterator>
+                inline static void pack_n(InputIterator in, std::size_t in_n, OutputIterator out, std::false_type) {
+                    while (in_n--) {
+                        InputType const value = *in++;
+                        exploder::explode(value, out);
+                    }
+                }
+
+                template<typename InputIterator, typename OutputIterator>
+                inline static void pack(InputIterator first, InputIterator last, OutputIterator out, std::true_type) {
+                    pack_n(first, std::distance(first, last), out, std::true_type());
+                }
+
+                template<typename InputIterator, typename OutputIterator>
+                inline static void pack(InputIterator first, InputIterator last, OutputIterator out,
+                                        std::false_type) {
                     while (first != last) {
                         InputType const value = *first++;
                         exploder::explode(value, out);
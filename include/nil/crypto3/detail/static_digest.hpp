@@ -27,14 +27,18 @@
 
 #include <boost/static_assert.hpp>
 #include <boost/assert.hpp>
+#include <boost/endian/conversion.hpp>
 
 #include <array>
 #include <string>
+#include <cstdint>
 #include <cstring>
+#include <functional>
 #include <iostream>
 
 #include <nil/crypto3/detail/octet.hpp>
 #include <nil/crypto3/detail/pack.hpp>
+#include <nil/crypto3/detail/digest_encoding.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -57,9 +61,11 @@ namespace nil {
          * an aggregate; A default-constructed digest has all its contained octets set to zero. The base_array()
          * member function provides a reference to the std::array sub-object.
          *
-         * digests with different numbers of bits may be compared. For the comparison, the smaller is considered
-         * as though it were padded with 0s out to the size of the larger. The operator< provides a strict total
-         * order. For convenience, equality comparison with narrow c-style strings is also provided.
+         * digests with different numbers of bits may be compared. They are never equal, and operator< orders
+         * digests lexicographically by octets, shorter first on a common prefix, which is a strict total order.
+         * Equality compares every octet regardless of where the first difference is. std::hash is specialized, so
+         * digests may key both ordered and unordered containers. For convenience, equality comparison with narrow
+         * c-style strings is also provided.
          *
          * Always stored internally as a sequence of octets in display order.
          * This allows digests from different algorithms to have the same type,
@@ -72,6 +78,47 @@ namespace nil {
         class static_digest : public std::array<octet_type, DigestBits / octet_bits> { };
 
         namespace detail {
+            /*!
+             * @brief Compares n octets 64 bits at a time, always reading all of them, so that the time taken
+             * does not depend on the position of the first difference.
+             */
+            inline bool octets_equal(const octet_type *a, const octet_type *b, std::size_t n) {
+                std::uint64_t diff = 0;
+                std::size_t i = 0;
+                for (; i + sizeof(diff) <= n; i += sizeof(diff)) {
+                    std::uint64_t x, y;
+                    std::memcpy(&x, a + i, sizeof(x));
+                    std::memcpy(&y, b + i, sizeof(y));
+                    diff |= x ^ y;
+                }
+                for (; i < n; ++i) {
+                    diff |= a[i] ^ b[i];
+                }
+                return !diff;
+            }
+
+            /*!
+             * @brief Lexicographic three-way comparison of n octets, comparing 64-bit big-endian words.
+             * @return Negative, zero or positive like std::memcmp
+             */
+            inline int octets_compare(const octet_type *a, const octet_type *b, std::size_t n) {
+                std::size_t i = 0;
+                for (; i + sizeof(std::uint64_t) <= n; i += sizeof(std::uint64_t)) {
+                    std::uint64_t x, y;
+                    std::memcpy(&x, a + i, sizeof(x));
+                    std::memcpy(&y, b + i, sizeof(y));
+                    if (x != y) {
+                        return boost::endian::big_to_native(x) < boost::endian::big_to_native(y) ? -1 : 1;
+                    }
+                }
+                for (; i < n; ++i) {
+                    if (a[i] != b[i]) {
+                        return a[i] < b[i] ? -1 : 1;
+                    }
+                }
+                return 0;
+            }
+
             template<std::size_t DigestBits, typename OutputIterator>
             OutputIterator to_ascii(const static_digest<DigestBits> &d, OutputIterator it) {
                 for (std::size_t j = 0; j < DigestBits / octet_bits; ++j) {
@@ -85,7 +132,7 @@ namespace nil {
             template<std::size_t DigestBits>
             std::array<char, DigestBits / 4 + 1> c_str(const static_digest<DigestBits> &d) {
                 std::array<char, DigestBits / 4 + 1> s;
-                char *p = to_ascii<DigestBits>(d, s.data());
+                char *p = hex_encoding::encode(d.data(), d.size(), s.data());
                 *p++ = '\0';
                 return s;
             }
@@ -99,6 +146,18 @@ namespace std {
         std::array<char, DigestBits / 4 + 1> cstr = nil::crypto3::detail::c_str(d);
         return std::string(cstr.data(), cstr.size() - 1);
     }
+
+    /*!
+     * @brief Digests are uniformly distributed already, so their first machine word is the hash value.
+     */
+    template<std::size_t DigestBits>
+    struct hash<nil::crypto3::static_digest<DigestBits>> {
+        std::size_t operator()(const nil::crypto3::static_digest<DigestBits> &d) const noexcept {
+            std::size_t h = 0;
+            std::memcpy(&h, d.data(), d.size() < sizeof(h) ? d.size() : sizeof(h));
+            return h;
+        }
+    };
 }    // namespace std
 
 namespace nil {
@@ -139,10 +198,7 @@ namespace nil {
 
         template<std::size_t DB1, std::size_t DB2>
         bool operator==(const static_digest<DB1> &a, const static_digest<DB2> &b) {
-            // TODO: Think about size of static_digest. We can't use resize here because
-            //  it's change element which we compare
-            return static_cast<bool>(DB1 == DB2 ? std::equal(std::begin(a), std::end(a), std::begin(b), std::end(b)) :
-                                                  0);
+            return DB1 == DB2 && detail::octets_equal(a.data(), b.data(), a.size());
         }
 
         template<std::size_t DB1, std::size_t DB2>
@@ -152,8 +208,8 @@ namespace nil {
 
         template<std::size_t DB1, std::size_t DB2>
         bool operator<(const static_digest<DB1> &a, const static_digest<DB2> &b) {
-            // #TODO: Implement this right
-            return DB1 < DB2;
+            const int r = detail::octets_compare(a.data(), b.data(), DB1 < DB2 ? a.size() : b.size());
+            return r < 0 || (!r && DB1 < DB2);
         }
 
         template<std::size_t DB1, std::size_t DB2>
@@ -174,7 +230,7 @@ namespace nil {
         template<std::size_t DB>
         bool operator!=(const static_digest<DB> &a, char const *b) {
             BOOST_ASSERT(std::strlen(b) == DB / 4);
-            return std::to_string(a) != b;
+            return std::strcmp(detail::c_str(a).data(), b) != 0;
         }
 
         template<std::size_t DB>
@@ -192,9 +248,63 @@ namespace nil {
             return a == b;
         }
 
+        /*!
+         * @brief Number of characters to_hex, to_base64url and to_base32 write for a DigestBits digest. No
+         * terminating null character is written by any of them.
+         * @tparam DigestBits
+         */
+        template<std::size_t DigestBits>
+        struct digest_encoded_size {
+            constexpr static const std::size_t hex = detail::hex_encoding::encoded_size(DigestBits / octet_bits);
+            constexpr static const std::size_t base64url =
+                detail::base64url_encoding::encoded_size(DigestBits / octet_bits);
+            constexpr static const std::size_t base32 = detail::base32_encoding::encoded_size(DigestBits / octet_bits);
+        };
+
+        /*!
+         * @brief Writes the lower case hexadecimal form of d, digest_encoded_size<DigestBits>::hex characters,
+         * to out.
+         * @return End of the written characters
+         */
+        template<std::size_t DigestBits>
+        char *to_hex(const static_digest<DigestBits> &d, char *out) {
+            return detail::hex_encoding::encode(d.data(), d.size(), out);
+        }
+
+        /*!
+         * @brief Parses exactly digest_encoded_size<DigestBits>::hex hexadecimal digits of either case.
+         * @return false if size is wrong or a character is not a hexadecimal digit. d is unspecified then.
+         */
+        template<std::size_t DigestBits>
+        bool from_hex(const char *in, std::size_t size, static_digest<DigestBits> &d) {
+            return size == digest_encoded_size<DigestBits>::hex && detail::hex_encoding::decode(in, d.size(), d.data());
+        }
+
+        /*!
+         * @brief Writes the unpadded base64url form of d, digest_encoded_size<DigestBits>::base64url
+         * characters, to out.
+         * @return End of the written characters
+         */
+        template<std::size_t DigestBits>
+        char *to_base64url(const static_digest<DigestBits> &d, char *out) {
+            return detail::base64url_encoding::encode(d.data(), d.size(), out);
+        }
+
+        /*!
+         * @brief Writes the unpadded base32 form of d, digest_encoded_size<DigestBits>::base32 characters, to
+         * out.
+         * @return End of the written characters
+         */
+        template<std::size_t DigestBits>
+        char *to_base32(const static_digest<DigestBits> &d, char *out) {
+            return detail::base32_encoding::encode(d.data(), d.size(), out);
+        }
+
         template<std::size_t DigestBits>
         std::ostream &operator<<(std::ostream &sink, const static_digest<DigestBits> &d) {
-            detail::to_ascii<DigestBits>(d, std::ostream_iterator<char>(sink));
+            std::array<char, digest_encoded_size<DigestBits>::hex> a;
+            to_hex(d, a.data());
+            sink.write(a.data(), a.size());
             return sink;
         }
 
@@ -207,17 +317,14 @@ namespace nil {
                     source.setstate(std::ios::failbit);
                     break;
                 }
-                if (!std::isxdigit(c, source.getloc())) {
+
+                const std::uint8_t v = detail::hex_encoding::digit_value(c);
+                if (v == 0xFF) {
                     source.unget();
                     source.setstate(std::ios::failbit);
                     break;
                 }
-
-                if (std::isdigit(c, source.getloc())) {
-                    a[i] = (c - '0');
-                } else {
-                    a[i] = std::toupper(c, source.getloc()) - 'A' + 0xA;
-                }
+                a[i] = v;
             }
             detail::pack<stream_endian::big_bit, stream_endian::big_bit, 4, 8>(a.begin(), a.end(), d.begin());
             return source;
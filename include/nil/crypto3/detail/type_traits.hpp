@@ -27,7 +27,10 @@
 #define CRYPTO3_TYPE_TRAITS_HPP
 
 #include <complex>
+#include <iterator>
+#include <string>
 #include <type_traits>
+#include <vector>
 
 #define GENERATE_HAS_MEMBER_TYPE(Type)                                                \
                                                                                       \
@@ -271,6 +274,31 @@ namespace nil {
                 constexpr static bool value = std::is_same<decltype(test(std::declval<T>())), long>::value;
             };
 
+            /*!
+             * @brief is_contiguous_iterator trait checks whether the iterator refers to elements stored
+             * contiguously in memory, so that [it, it + n) can be accessed through a plain pointer.
+             * As C++20 contiguous_iterator concept is not available, the trait recognizes pointers and
+             * iterators of std::vector (except std::vector<bool>) and std::string.
+             *
+             * @tparam Iterator
+             */
+            template<typename Iterator, bool IsPointer = std::is_pointer<Iterator>::value>
+            struct is_contiguous_iterator {
+                constexpr static bool value = true;
+            };
+
+            template<typename Iterator>
+            struct is_contiguous_iterator<Iterator, false> {
+                typedef typename std::iterator_traits<Iterator>::value_type value_type;
+
+                constexpr static bool value =
+                    (!std::is_same<value_type, bool>::value &&
+                     (std::is_same<Iterator, typename std::vector<value_type>::iterator>::value ||
+                      std::is_same<Iterator, typename std::vector<value_type>::const_iterator>::value)) ||
+                    std::is_same<Iterator, std::string::iterator>::value ||
+                    std::is_same<Iterator, std::string::const_iterator>::value;
+            };
+
             template<typename Range>
             struct is_range {
                 static const bool value = has_begin<Range>::value && has_end<Range>::value;
@@ -58,6 +58,13 @@ namespace nil {
                         return cnt;
                     }
 
+                    /*!
+                     * @brief Resumes counting from bits, e.g. along with a restored hash state.
+                     */
+                    inline void restore(result_type bits) {
+                        cnt = bits;
+                    }
+
                 protected:
                     template<typename Block>
                     inline void resolve_type(const Block &value, std::size_t bits) {
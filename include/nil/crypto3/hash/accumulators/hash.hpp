@@ -43,6 +43,10 @@
 
 #include <nil/crypto3/hash/accumulators/bits_count.hpp>
 
+#include <nil/crypto3/hash/detail/block_run.hpp>
+#include <nil/crypto3/hash/detail/instrument.hpp>
+#include <nil/crypto3/hash/detail/state_serializer.hpp>
+
 #include <nil/crypto3/hash/accumulators/parameters/bits.hpp>
 
 #include <boost/accumulators/statistics/count.hpp>
@@ -79,11 +83,14 @@ namespace nil {
                     typedef ::nil::crypto3::detail::injector<endian_type, word_bits, block_words, block_bits>
                         injector_type;
 
+                    typedef hashes::detail::state_serializer<construction_type> serializer_type;
+
                 public:
                     typedef typename hash_type::digest_type result_type;
 
                     // The constructor takes an argument pack.
                     hash_impl(boost::accumulators::dont_care) : filled(false), total_seen(0) {
+                        CRYPTO3_HASH_INSTRUMENT_NAME(construction_type, hash_type);
                     }
 
                     template<typename ArgumentPack>
@@ -97,6 +104,42 @@ namespace nil {
                         return res.digest(cache, total_seen);
                     }
 
+                    /*!
+                     * @brief Number of message bits absorbed so far.
+                     */
+                    inline std::size_t bits_seen() const {
+                        return total_seen;
+                    }
+
+                    /*!
+                     * @brief Writes the mid-stream state in the portable format of hashes::detail::state_serializer.
+                     */
+                    template<typename OutputIterator>
+                    inline OutputIterator save(OutputIterator out) const {
+                        return serializer_type::save(construction.state(), cache, total_seen, out);
+                    }
+
+                    /*!
+                     * @brief Replaces the mid-stream state with one written by save.
+                     * @return false if the input is malformed or was saved for another hash
+                     */
+                    template<typename InputIterator>
+                    inline bool load(InputIterator first, InputIterator last) {
+                        typename construction_type::state_type state;
+                        block_type block;
+                        std::uint64_t seen;
+
+                        if (!serializer_type::load(first, last, state, block, seen)) {
+                            return false;
+                        }
+
+                        construction.restore(state);
+                        cache = block;
+                        total_seen = seen;
+                        filled = total_seen && !(total_seen % block_bits);
+                        return true;
+                    }
+
                 protected:
                     inline void resolve_type(const block_type &value, std::size_t bits) {
                         // total_seen += bits == 0 ? block_bits : bits;
@@ -108,9 +151,50 @@ namespace nil {
                         process(value, bits == 0 ? word_bits : bits);
                     }
 
+                    inline void resolve_type(const hashes::detail::block_run<word_type> &run, std::size_t) {
+                        process(run);
+                    }
+
+                    /*!
+                     * @brief All blocks of the run but the last go to the construction in one process_blocks
+                     * call, the last one is kept in the cache like a single full block.
+                     */
+                    inline void process(const hashes::detail::block_run<word_type> &run) {
+                        if (!run.n) {
+                            return;
+                        }
+
+                        if (total_seen % block_bits) {
+                            // Not on a block boundary, the run has to be spliced into the cached bits
+                            for (std::size_t i = 0; i != run.n; ++i) {
+                                block_type block;
+                                std::copy(run.blocks + i * block_words, run.blocks + (i + 1) * block_words,
+                                          block.begin());
+                                process(block, block_bits);
+                            }
+                            return;
+                        }
+
+                        CRYPTO3_HASH_INSTRUMENT_ADD(construction_type, bits_absorbed, run.n * block_bits);
+
+                        if (filled) {
+                            construction.process_block(cache, total_seen);
+                        }
+                        if (run.n > 1) {
+                            construction.process_blocks(run.blocks, run.n - 1, total_seen + block_bits);
+                        }
+                        total_seen += run.n * block_bits;
+
+                        const word_type *last = run.blocks + (run.n - 1) * block_words;
+                        std::copy(last, last + block_words, cache.begin());
+                        filled = true;
+                    }
+
                     inline void process(const block_type &value, std::size_t value_seen) {
                         using namespace ::nil::crypto3::detail;
 
+                        CRYPTO3_HASH_INSTRUMENT_ADD(construction_type, bits_absorbed, value_seen);
+
                         if (filled) {
                             construction.process_block(cache, total_seen);
                             filled = false;
@@ -172,6 +256,8 @@ namespace nil {
                     inline void process(const word_type &value, std::size_t value_seen) {
                         using namespace ::nil::crypto3::detail;
 
+                        CRYPTO3_HASH_INSTRUMENT_ADD(construction_type, bits_absorbed, value_seen);
+
                         if (filled) {
                             construction.process_block(cache, total_seen);
                             filled = false;
@@ -0,0 +1,163 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_BATCH_HPP
+#define CRYPTO3_HASH_BATCH_HPP
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+
+#include <nil/crypto3/detail/type_traits.hpp>
+
+#include <nil/crypto3/hash/hasher.hpp>
+#include <nil/crypto3/hash/multi_buffer.hpp>
+#include <nil/crypto3/hash/thread_pool.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                template<typename Hash, typename Message>
+                struct is_multi_buffer_input {
+                    typedef decltype(std::begin(std::declval<const Message &>())) iterator_type;
+                    typedef typename std::iterator_traits<iterator_type>::value_type value_type;
+
+                    constexpr static const bool value =
+                        !std::is_same<typename multi_buffer_engine<Hash>::type, basic_multi_buffer<Hash>>::value &&
+                        ::nil::crypto3::detail::is_contiguous_iterator<iterator_type>::value &&
+                        std::is_integral<value_type>::value && sizeof(value_type) == sizeof(octet_type);
+                };
+
+                /*!
+                 * @brief Hashes messages[first, last) to out[first, last) with a single hasher reused for
+                 * every message.
+                 */
+                template<typename Hash, typename RandomAccessRange, typename RandomAccessIterator>
+                void hash_batch_chunk(const RandomAccessRange &messages, std::size_t first, std::size_t last,
+                                      RandomAccessIterator out, std::false_type) {
+                    hasher<Hash> h;
+                    for (std::size_t i = first; i != last; ++i) {
+                        out[i] = h.update(std::begin(messages)[i]).finalize();
+                    }
+                }
+
+                /*!
+                 * @brief Hashes messages[first, last) to out[first, last) with the SIMD multi-buffer engine,
+                 * a fixed number of messages at a time.
+                 */
+                template<typename Hash, typename RandomAccessRange, typename RandomAccessIterator>
+                void hash_batch_chunk(const RandomAccessRange &messages, std::size_t first, std::size_t last,
+                                      RandomAccessIterator out, std::true_type) {
+                    constexpr static const std::size_t group = 64;
+
+                    const octet_type *pointers[group];
+                    std::size_t sizes[group];
+                    typename Hash::digest_type digests[group];
+
+                    while (first != last) {
+                        std::size_t count = std::min(group, last - first);
+                        for (std::size_t i = 0; i != count; ++i) {
+                            const auto &m = std::begin(messages)[first + i];
+                            pointers[i] = reinterpret_cast<const octet_type *>(std::data(m));
+                            sizes[i] = std::size(m);
+                        }
+                        multi_buffer<Hash>::process(pointers, sizes, count, digests);
+                        std::copy(digests, digests + count, out + first);
+                        first += count;
+                    }
+                }
+            }    // namespace detail
+        }        // namespace hashes
+
+        /*!
+         * @brief Hashes every message of a random access range of messages and writes the digest of
+         * messages[i] to out[i]. The range is split into contiguous chunks which the executor runs
+         * concurrently, each with its own hash state; out must address messages.size() preallocated
+         * digests. Contiguous octet messages of hashes with a multi-buffer engine (SHA-224, SHA-256) are
+         * additionally interleaved across SIMD lanes within a chunk.
+         *
+         * @ingroup hash_algorithms
+         *
+         * @tparam Hash
+         * @tparam RandomAccessRange
+         * @tparam RandomAccessIterator
+         * @tparam Executor
+         *
+         * @param messages
+         * @param out
+         * @param executor See hashes::sequential_executor for the interface.
+         *
+         * @return out advanced past the last digest written
+         */
+        template<typename Hash, typename RandomAccessRange, typename RandomAccessIterator, typename Executor>
+        RandomAccessIterator hash_batch(const RandomAccessRange &messages, RandomAccessIterator out,
+                                        Executor &executor) {
+            typedef typename std::iterator_traits<decltype(std::begin(messages))>::value_type message_type;
+            typedef std::integral_constant<bool, hashes::detail::is_multi_buffer_input<Hash, message_type>::value>
+                multi_buffer_input;
+
+            // A few chunks per thread even out messages of different lengths, the lower bound keeps the
+            // per-chunk setup and the SIMD lanes amortized.
+            constexpr static const std::size_t chunks_per_thread = 4;
+            constexpr static const std::size_t min_chunk_size = 64;
+
+            const std::size_t n = std::distance(std::begin(messages), std::end(messages));
+            std::size_t chunk_size = (n + executor.concurrency() * chunks_per_thread - 1) /
+                                     (executor.concurrency() * chunks_per_thread);
+            chunk_size = std::max(chunk_size, min_chunk_size);
+            const std::size_t chunks = (n + chunk_size - 1) / chunk_size;
+
+            executor.parallel_for(chunks, [&](std::size_t chunk) {
+                hashes::detail::hash_batch_chunk<Hash>(messages, chunk * chunk_size,
+                                                       std::min(n, (chunk + 1) * chunk_size), out,
+                                                       multi_buffer_input());
+            });
+
+            return out + n;
+        }
+
+        /*!
+         * @brief Hashes every message of a random access range of messages on the process-wide
+         * hashes::thread_pool::shared() pool.
+         *
+         * @ingroup hash_algorithms
+         *
+         * @tparam Hash
+         * @tparam RandomAccessRange
+         * @tparam RandomAccessIterator
+         *
+         * @param messages
+         * @param out
+         *
+         * @return out advanced past the last digest written
+         */
+        template<typename Hash, typename RandomAccessRange, typename RandomAccessIterator>
+        RandomAccessIterator hash_batch(const RandomAccessRange &messages, RandomAccessIterator out) {
+            return hash_batch<Hash>(messages, out, hashes::thread_pool::shared());
+        }
+    }    // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_BATCH_HPP
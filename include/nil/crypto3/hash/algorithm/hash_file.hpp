@@ -0,0 +1,199 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_FILE_HPP
+#define CRYPTO3_HASH_FILE_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_UNISTD_H
+
+#include <algorithm>
+#include <cerrno>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <nil/crypto3/detail/octet.hpp>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/detail/aligned_buffer.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            /*!
+             * @brief Tuning of hash_file.
+             */
+            struct file_options {
+                /// Map regular files into memory instead of reading them
+                bool mmap = true;
+                /// Ask for transparent huge pages on the mapping (MADV_HUGEPAGE), where supported
+                bool huge_pages = false;
+                /// Size of the read buffer used when the file is not mapped
+                std::size_t buffer_octets = 1 << 20;
+            };
+
+            namespace detail {
+                template<typename Hash, typename HashAccumulator>
+                bool hash_mapped_file(int fd, std::size_t size, HashAccumulator &acc, const file_options &options) {
+                    void *p = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+                    if (p == MAP_FAILED) {
+                        return false;
+                    }
+
+                    ::madvise(p, size, MADV_SEQUENTIAL);
+#ifdef MADV_HUGEPAGE
+                    if (options.huge_pages) {
+                        ::madvise(p, size, MADV_HUGEPAGE);
+                    }
+#endif
+
+                    const octet_type *first = static_cast<const octet_type *>(p);
+                    ::nil::crypto3::hash<Hash>(first, first + size, acc);
+
+                    ::munmap(p, size);
+                    return true;
+                }
+
+                template<typename Hash, typename HashAccumulator>
+                bool hash_read_file(int fd, HashAccumulator &acc, const file_options &options) {
+                    // One buffer per thread, reused by every call
+                    static thread_local aligned_buffer buffer;
+
+                    // Whole blocks per read keep the accumulator block-aligned between reads
+                    constexpr static const std::size_t block_octets = Hash::block_bits / octet_bits;
+                    const std::size_t size =
+                        std::max(block_octets, options.buffer_octets / block_octets * block_octets);
+
+                    octet_type *p = buffer.reserve(size);
+                    if (!p) {
+                        return false;
+                    }
+
+#ifdef POSIX_FADV_SEQUENTIAL
+                    ::posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+                    // pread on files, read on pipes and other unseekable descriptors
+                    bool seekable = true;
+                    off_t offset = 0;
+                    while (true) {
+                        std::size_t filled = 0;
+                        while (filled != size) {
+                            ssize_t r = seekable ? ::pread(fd, p + filled, size - filled, offset) :
+                                                   ::read(fd, p + filled, size - filled);
+                            if (r < 0 && errno == ESPIPE && seekable) {
+                                seekable = false;
+                                continue;
+                            }
+                            if (r < 0 && errno == EINTR) {
+                                continue;
+                            }
+                            if (r < 0) {
+                                return false;
+                            }
+                            if (r == 0) {
+                                break;
+                            }
+                            filled += r;
+                            offset += r;
+                        }
+
+                        ::nil::crypto3::hash<Hash>(p, p + filled, acc);
+                        if (filled != size) {
+                            return true;
+                        }
+                    }
+                }
+            }    // namespace detail
+        }        // namespace hashes
+
+        /*!
+         * @brief Feeds the contents of an open file descriptor to a hash accumulator. Regular files are
+         * memory-mapped with a sequential access hint and hashed in place; pipes, empty-looking files
+         * (e.g. in /proc) and files which can't be mapped are read into a reusable page-aligned buffer.
+         * Seekable files are hashed from offset 0, pipes from their current position.
+         *
+         * @ingroup hash_algorithms
+         *
+         * @return false if reading the descriptor failed, the accumulator state is unspecified then.
+         */
+        template<typename Hash, typename HashAccumulator = accumulator_set<Hash>>
+        typename std::enable_if<boost::accumulators::detail::is_accumulator_set<HashAccumulator>::value, bool>::type
+            hash_file(int fd, HashAccumulator &acc, const hashes::file_options &options = hashes::file_options()) {
+            struct stat st;
+            if (::fstat(fd, &st)) {
+                return false;
+            }
+
+            if (options.mmap && S_ISREG(st.st_mode) && st.st_size > 0 &&
+                hashes::detail::hash_mapped_file<Hash>(fd, st.st_size, acc, options)) {
+                return true;
+            }
+            return hashes::detail::hash_read_file<Hash>(fd, acc, options);
+        }
+
+        /*!
+         * @brief Computes the digest of the file at path.
+         *
+         * @ingroup hash_algorithms
+         *
+         * @return false if the file could not be opened or read, digest is left unchanged then.
+         */
+        template<typename Hash>
+        bool hash_file(const char *path, typename Hash::digest_type &digest,
+                       const hashes::file_options &options = hashes::file_options()) {
+            int fd;
+            do {
+                fd = ::open(path, O_RDONLY | O_CLOEXEC);
+            } while (fd < 0 && errno == EINTR);
+            if (fd < 0) {
+                return false;
+            }
+
+            accumulator_set<Hash> acc;
+            bool result = hash_file<Hash>(fd, acc, options);
+            ::close(fd);
+
+            if (result) {
+                digest = accumulators::extract::hash<Hash>(acc);
+            }
+            return result;
+        }
+
+        template<typename Hash>
+        bool hash_file(const std::string &path, typename Hash::digest_type &digest,
+                       const hashes::file_options &options = hashes::file_options()) {
+            return hash_file<Hash>(path.c_str(), digest, options);
+        }
+    }    // namespace crypto3
+}    // namespace nil
+
+#endif    // BOOST_HAS_UNISTD_H
+
+#endif    // CRYPTO3_HASH_FILE_HPP
@@ -61,25 +61,18 @@ namespace nil {
                 typedef typename policy_type::salt_type salt_type;
                 constexpr static const salt_type salt_value = policy_type::salt_value;
 
-                static void process_block(state_type &state, const block_type &block, value_type seen = value_type(),
-                                          value_type finalizator = value_type()) {
-                    std::array<word_type, state_words * 2> v;
-
-                    std::move(state.begin(), state.end(), v.begin());
-                    std::move(iv_generator()().begin(), iv_generator()().end(), v.begin() + state_words);
-
-                    std::array<typename state_type::value_type, 2> s = {seen / CHAR_BIT + ((seen % CHAR_BIT) ? 1 : 0),
-                                                                        0x00};
-
-                    v[12] ^= s[0];
-                    v[13] ^= s[1];
-
-                    s = {finalizator, 0};
-
-                    v[14] ^= s[0];
-                    v[15] ^= s[1];
+                constexpr static void process_block(state_type &state, const block_type &block,
+                                                    value_type seen = value_type(),
+                                                    value_type finalizator = value_type()) {
+                    std::array<word_type, state_words * 2> v = {};
+
+                    for (std::size_t i = 0; i != state_words; ++i) {
+                        v[i] = state[i];
+                        v[i + state_words] = iv_generator()()[i];
+                    }
 
-                    s.fill(0);
+                    v[12] ^= seen / CHAR_BIT + ((seen % CHAR_BIT) ? 1 : 0);
+                    v[14] ^= finalizator;
 
                     policy_type::template round<0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15>(v, block);
                     policy_type::template round<14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3>(v, block);
@@ -98,6 +91,19 @@ namespace nil {
                         state[i] ^= v[i] ^ v[i + state_words];
                     }
                 }
+
+                /*!
+                 * @brief Processes n consecutive non-final blocks of block_words words each.
+                 * @param seen Bits seen by the end of the first block. Each next block adds block_bits to it.
+                 */
+                static void process_blocks(state_type &state, const word_type *blocks, std::size_t n,
+                                           value_type seen = block_bits) {
+                    block_type block;
+                    for (; n; --n, blocks += block_words, seen += block_bits) {
+                        std::copy(blocks, blocks + block_words, block.begin());
+                        process_block(state, block, seen);
+                    }
+                }
             };
 
             /*!
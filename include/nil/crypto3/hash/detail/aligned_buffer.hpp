@@ -0,0 +1,100 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_DETAIL_ALIGNED_BUFFER_HPP
+#define CRYPTO3_HASH_DETAIL_ALIGNED_BUFFER_HPP
+
+#include <new>
+#include <utility>
+
+#include <nil/crypto3/detail/octet.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                /*!
+                 * @brief Page-aligned octet buffer which only ever grows, for I/O buffers which are reused
+                 * across reads.
+                 */
+                class aligned_buffer {
+                public:
+                    constexpr static const std::size_t alignment = 4096;
+
+                    aligned_buffer() : p(nullptr), n(0) {
+                    }
+
+                    aligned_buffer(aligned_buffer &&other) : p(other.p), n(other.n) {
+                        other.p = nullptr;
+                        other.n = 0;
+                    }
+
+                    aligned_buffer(const aligned_buffer &) = delete;
+                    aligned_buffer &operator=(const aligned_buffer &) = delete;
+
+                    ~aligned_buffer() {
+                        release();
+                    }
+
+                    /*!
+                     * @brief Makes the buffer hold at least size octets. The contents are not preserved.
+                     * @return The buffer or nullptr if the allocation failed.
+                     */
+                    octet_type *reserve(std::size_t size) {
+                        if (size > n) {
+                            void *q = ::operator new(size, std::align_val_t(alignment), std::nothrow);
+                            if (!q) {
+                                return nullptr;
+                            }
+                            release();
+                            p = static_cast<octet_type *>(q);
+                            n = size;
+                        }
+                        return p;
+                    }
+
+                    octet_type *data() const {
+                        return p;
+                    }
+
+                    std::size_t size() const {
+                        return n;
+                    }
+
+                private:
+                    void release() {
+                        if (p) {
+                            ::operator delete(p, std::align_val_t(alignment));
+                        }
+                    }
+
+                    octet_type *p;
+                    std::size_t n;
+                };
+            }    // namespace detail
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_DETAIL_ALIGNED_BUFFER_HPP
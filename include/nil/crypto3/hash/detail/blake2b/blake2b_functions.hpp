@@ -44,8 +44,8 @@ namespace nil {
 
                     constexpr static const std::size_t state_words = policy_type::state_words;
 
-                    inline static void g(word_type &a, word_type &b, word_type &c, word_type &d, word_type M0,
-                                         word_type M1) {
+                    constexpr inline static void g(word_type &a, word_type &b, word_type &c, word_type &d,
+                                                   word_type M0, word_type M1) {
                         a = a + b + M0;
                         d = policy_type::template rotr<32>(d ^ a);
                         c = c + d;
@@ -58,8 +58,8 @@ namespace nil {
 
                     template<size_t i0, size_t i1, size_t i2, size_t i3, size_t i4, size_t i5, size_t i6, size_t i7,
                              size_t i8, size_t i9, size_t iA, size_t iB, size_t iC, size_t iD, size_t iE, size_t iF>
-                    inline static void round(std::array<word_type, state_words * 2> &v,
-                                             const std::array<word_type, state_words * 2> &M) {
+                    constexpr inline static void round(std::array<word_type, state_words * 2> &v,
+                                                       const std::array<word_type, state_words * 2> &M) {
                         g(v[0], v[4], v[8], v[12], M[i0], M[i1]);
                         g(v[1], v[5], v[9], v[13], M[i2], M[i3]);
                         g(v[2], v[6], v[10], v[14], M[i4], M[i5]);
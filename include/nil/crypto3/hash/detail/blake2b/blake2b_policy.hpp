@@ -54,12 +54,13 @@ namespace nil {
 
                     constexpr static const std::size_t rounds = 12;
 
+                    constexpr static const state_type initial_state = {
+                        {0x6a09e667f3bcc908, 0xbb67ae8584caa73b, 0x3c6ef372fe94f82b, 0xa54ff53a5f1d36f1,
+                         0x510e527fade682d1, 0x9b05688c2b3e6c1f, 0x1f83d9abfb41bd6b, 0x5be0cd19137e2179}};
+
                     struct iv_generator {
-                        state_type const &operator()() const {
-                            constexpr static const state_type H0 = {
-                                {0x6a09e667f3bcc908, 0xbb67ae8584caa73b, 0x3c6ef372fe94f82b, 0xa54ff53a5f1d36f1,
-                                 0x510e527fade682d1, 0x9b05688c2b3e6c1f, 0x1f83d9abfb41bd6b, 0x5be0cd19137e2179}};
-                            return H0;
+                        constexpr state_type const &operator()() const {
+                            return initial_state;
                         }
                     };
 
@@ -67,6 +68,10 @@ namespace nil {
                     typedef typename boost::uint_t<salt_bits>::exact salt_type;
                     constexpr static const salt_type salt_value = 0xFFFFFFFFFFFFFFFF;
                 };
+
+                template<std::size_t DigestBits>
+                constexpr typename blake2b_policy<DigestBits>::state_type const
+                    blake2b_policy<DigestBits>::initial_state;
             }    // namespace detail
         }        // namespace hashes
     }            // namespace crypto3
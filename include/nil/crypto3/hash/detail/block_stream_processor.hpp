@@ -26,14 +26,18 @@
 #ifndef CRYPTO3_HASH_BLOCK_STREAM_PROCESSOR_HPP
 #define CRYPTO3_HASH_BLOCK_STREAM_PROCESSOR_HPP
 
+#include <algorithm>
 #include <array>
 #include <iterator>
 
 #include <nil/crypto3/detail/pack.hpp>
 #include <nil/crypto3/detail/pack_numeric.hpp>
+#include <nil/crypto3/detail/type_traits.hpp>
 
 #include <nil/crypto3/hash/accumulators/bits_count.hpp>
 #include <nil/crypto3/hash/accumulators/parameters/bits.hpp>
+#include <nil/crypto3/hash/detail/block_run.hpp>
+#include <nil/crypto3/hash/detail/instrument.hpp>
 
 #include <boost/integer.hpp>
 #include <boost/static_assert.hpp>
@@ -60,8 +64,10 @@ namespace nil {
                 typedef Params params_type;
 
                 constexpr static const std::size_t word_bits = construction_type::word_bits;
+                typedef typename construction_type::word_type word_type;
 
                 constexpr static const std::size_t block_bits = construction_type::block_bits;
+                constexpr static const std::size_t block_words = construction_type::block_words;
                 typedef typename construction_type::block_type block_type;
 
             public:
@@ -80,11 +86,76 @@ namespace nil {
                     using namespace nil::crypto3::detail;
                     // Convert the input into words
                     block_type block;
-                    pack_to<endian_type, value_bits, word_bits>(cache.begin(), cache.end(), block.begin());
+                    {
+                        CRYPTO3_HASH_INSTRUMENT_ADD(construction_type, blocks_packed, 1);
+                        CRYPTO3_HASH_INSTRUMENT_TIME(construction_type, packing_ns);
+                        pack_to<endian_type, value_bits, word_bits>(cache.begin(), cache.end(), block.begin());
+                    }
                     // Process the block
                     acc(block, accumulators::bits = block_seen);
                 }
 
+                /*!
+                 * @brief Packs n whole blocks straight from the caller's buffer, bypassing the cache, and hands
+                 * them to the accumulator as a single run.
+                 */
+                template<typename InputType>
+                inline void process_blocks(const InputType *first, std::size_t n) {
+                    using namespace nil::crypto3::detail;
+                    word_type blocks[hashes::detail::block_run_blocks * block_words];
+                    {
+                        CRYPTO3_HASH_INSTRUMENT_ADD(construction_type, blocks_packed, n);
+                        CRYPTO3_HASH_INSTRUMENT_TIME(construction_type, packing_ns);
+                        pack_to<endian_type, value_bits, word_bits>(first, first + n * block_values, blocks);
+                    }
+                    acc(hashes::detail::block_run<word_type>{blocks, n}, accumulators::bits = n * block_bits);
+                }
+
+                /*!
+                 * @brief Contiguous input of value_bits-sized elements is packed in runs of whole blocks
+                 * directly from the input memory. Only the unaligned head and the tail go through the cache.
+                 */
+                template<typename InputIterator>
+                struct is_contiguous_input {
+                    typedef typename std::iterator_traits<InputIterator>::value_type input_value_type;
+
+                    constexpr static const bool value =
+                        ::nil::crypto3::detail::is_contiguous_iterator<InputIterator>::value &&
+                        std::is_integral<input_value_type>::value && sizeof(input_value_type) * CHAR_BIT == value_bits;
+                };
+
+                template<typename InputIterator>
+                inline void update_n(InputIterator p, std::size_t n, std::true_type) {
+                    if (!n) {
+                        return;
+                    }
+
+                    const typename std::iterator_traits<InputIterator>::value_type *first = &*p;
+
+                    // Complete the partially filled cache first
+                    for (; n && cache_seen; --n) {
+                        update_one(*first++);
+                    }
+
+                    while (n >= block_values) {
+                        std::size_t blocks = std::min(n / block_values, hashes::detail::block_run_blocks);
+                        process_blocks(first, blocks);
+                        first += blocks * block_values;
+                        n -= blocks * block_values;
+                    }
+
+                    for (; n; --n) {
+                        update_one(*first++);
+                    }
+                }
+
+                template<typename InputIterator>
+                inline void update_n(InputIterator p, std::size_t n, std::false_type) {
+                    for (; n; --n) {
+                        update_one(*p++);
+                    }
+                }
+
             public:
                 inline void update_one(value_type value) {
                     cache[cache_seen] = value;
@@ -98,9 +169,7 @@ namespace nil {
 
                 template<typename InputIterator>
                 inline void update_n(InputIterator p, size_t n) {
-                    for (; n; --n) {
-                        update_one(*p++);
-                    }
+                    update_n(p, n, std::integral_constant<bool, is_contiguous_input<InputIterator>::value>());
                 }
 
                 template<typename InputIterator>
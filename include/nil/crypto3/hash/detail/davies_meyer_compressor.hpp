@@ -26,6 +26,7 @@
 #define CRYPTO3_HASH_DAVIES_MEYER_COMPRESSOR_HPP
 
 #include <cstddef>
+#include <algorithm>
 
 namespace nil {
     namespace crypto3 {
@@ -61,6 +62,17 @@ namespace nil {
                     CombineFunction f;
                     f(state, new_state);
                 }
+
+                /*!
+                 * @brief Processes n consecutive blocks of block_words words each.
+                 */
+                inline static void process_blocks(state_type &state, const word_type *blocks, std::size_t n) {
+                    block_type block;
+                    for (; n; --n, blocks += block_words) {
+                        std::copy(blocks, blocks + block_words, block.begin());
+                        process_block(state, block);
+                    }
+                }
             };
         }    // namespace hashes
     }        // namespace crypto3
@@ -0,0 +1,630 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_DETAIL_DIGEST_TABLE_HPP
+#define CRYPTO3_HASH_DETAIL_DIGEST_TABLE_HPP
+
+#include <boost/config.hpp>
+#include <boost/static_assert.hpp>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#ifdef BOOST_HAS_UNISTD_H
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cstdio>
+#endif
+
+#if !defined(CRYPTO3_DISABLE_CPU_EXTENSIONS) && defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <nil/crypto3/detail/static_digest.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                inline unsigned lowest_bit(std::uint32_t m) {
+#if defined(__GNUC__)
+                    return __builtin_ctz(m);
+#else
+                    unsigned i = 0;
+                    for (; !(m & 1); m >>= 1) {
+                        ++i;
+                    }
+                    return i;
+#endif
+                }
+
+                /*!
+                 * @brief Match masks over the 16 control octets of a digest_table group, bit i standing for
+                 * slot i. A control octet holds 7 bits of the digest for a full slot, or one of the empty and
+                 * deleted markers, both of which have the top bit set.
+                 */
+                struct digest_table_group {
+                    constexpr static const std::size_t width = 16;
+
+                    constexpr static const std::uint8_t empty = 0x80;
+                    constexpr static const std::uint8_t deleted = 0xFE;
+
+                    explicit digest_table_group(const std::uint8_t *control) : control(control) {
+                    }
+
+                    std::uint32_t match(std::uint8_t h2) const {
+#if !defined(CRYPTO3_DISABLE_CPU_EXTENSIONS) && defined(__SSE2__)
+                        return _mm_movemask_epi8(_mm_cmpeq_epi8(load(), _mm_set1_epi8(static_cast<char>(h2))));
+#else
+                        std::uint32_t m = 0;
+                        for (std::size_t i = 0; i != width; ++i) {
+                            m |= std::uint32_t(control[i] == h2) << i;
+                        }
+                        return m;
+#endif
+                    }
+
+                    std::uint32_t match_empty() const {
+                        return match(empty);
+                    }
+
+                    std::uint32_t match_empty_or_deleted() const {
+#if !defined(CRYPTO3_DISABLE_CPU_EXTENSIONS) && defined(__SSE2__)
+                        return _mm_movemask_epi8(load());
+#else
+                        std::uint32_t m = 0;
+                        for (std::size_t i = 0; i != width; ++i) {
+                            m |= std::uint32_t(control[i] >> 7) << i;
+                        }
+                        return m;
+#endif
+                    }
+
+                private:
+#if !defined(CRYPTO3_DISABLE_CPU_EXTENSIONS) && defined(__SSE2__)
+                    __m128i load() const {
+                        return _mm_load_si128(reinterpret_cast<const __m128i *>(control));
+                    }
+#endif
+
+                    const std::uint8_t *control;
+                };
+
+                /*!
+                 * @brief Memory a digest_table lives in: cache line aligned heap memory, or a file mapped
+                 * shared, so that the table persists in it.
+                 */
+                class digest_table_storage {
+                public:
+                    constexpr static const std::size_t alignment = 64;
+
+                    /// Outcome of map()
+                    enum map_result { map_done, map_missing, map_empty, map_failed };
+
+                    digest_table_storage() : p(nullptr), n(0), fd(-1) {
+                    }
+
+                    digest_table_storage(digest_table_storage &&other) : p(nullptr), n(0), fd(-1) {
+                        swap(other);
+                    }
+
+                    digest_table_storage &operator=(digest_table_storage &&other) {
+                        swap(other);
+                        return *this;
+                    }
+
+                    digest_table_storage(const digest_table_storage &) = delete;
+                    digest_table_storage &operator=(const digest_table_storage &) = delete;
+
+                    ~digest_table_storage() {
+                        release();
+                    }
+
+                    /*!
+                     * @brief Allocates heap memory. Throws std::bad_alloc on failure.
+                     */
+                    void allocate(std::size_t size) {
+                        release();
+                        p = static_cast<std::uint8_t *>(::operator new(size, std::align_val_t(alignment)));
+                        n = size;
+                    }
+
+#ifdef BOOST_HAS_UNISTD_H
+                    /*!
+                     * @brief Creates or truncates the file at file_path to size octets and maps it.
+                     */
+                    bool create(const std::string &file_path, std::size_t size) {
+                        release();
+                        int f = open_file(file_path, O_RDWR | O_CREAT | O_TRUNC);
+                        if (f < 0) {
+                            return false;
+                        }
+                        if (::ftruncate(f, static_cast<off_t>(size))) {
+                            ::close(f);
+                            return false;
+                        }
+                        return adopt(f, file_path, size);
+                    }
+
+                    /*!
+                     * @brief Maps the existing non-empty regular file at file_path.
+                     * @return map_done on success, map_missing if there is no such file, map_empty if it is an
+                     * empty regular file, map_failed otherwise
+                     */
+                    map_result map(const std::string &file_path) {
+                        release();
+                        int f = open_file(file_path, O_RDWR);
+                        if (f < 0) {
+                            return errno == ENOENT ? map_missing : map_failed;
+                        }
+                        struct stat st;
+                        const bool regular = !::fstat(f, &st) && S_ISREG(st.st_mode);
+                        if (!regular || st.st_size <= 0) {
+                            ::close(f);
+                            return regular && !st.st_size ? map_empty : map_failed;
+                        }
+                        return adopt(f, file_path, static_cast<std::size_t>(st.st_size)) ? map_done : map_failed;
+                    }
+
+                    bool sync() const {
+                        return !mapped() || !::msync(p, n, MS_SYNC);
+                    }
+#endif
+
+                    bool mapped() const {
+                        return fd >= 0;
+                    }
+
+                    std::uint8_t *data() const {
+                        return p;
+                    }
+
+                    std::size_t size() const {
+                        return n;
+                    }
+
+                    const std::string &file_path() const {
+                        return path;
+                    }
+
+                    void set_file_path(const std::string &file_path) {
+                        path = file_path;
+                    }
+
+                    void swap(digest_table_storage &other) {
+                        std::swap(p, other.p);
+                        std::swap(n, other.n);
+                        std::swap(fd, other.fd);
+                        path.swap(other.path);
+                    }
+
+                    void release() {
+#ifdef BOOST_HAS_UNISTD_H
+                        if (mapped()) {
+                            ::munmap(p, n);
+                            ::close(fd);
+                            p = nullptr;
+                        }
+#endif
+                        if (p) {
+                            ::operator delete(p, std::align_val_t(alignment));
+                        }
+                        p = nullptr;
+                        n = 0;
+                        fd = -1;
+                        path.clear();
+                    }
+
+                private:
+#ifdef BOOST_HAS_UNISTD_H
+                    static int open_file(const std::string &file_path, int flags) {
+                        int f;
+                        do {
+                            f = ::open(file_path.c_str(), flags | O_CLOEXEC, 0644);
+                        } while (f < 0 && errno == EINTR);
+                        return f;
+                    }
+
+                    bool adopt(int f, const std::string &file_path, std::size_t size) {
+                        void *q = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, f, 0);
+                        if (q == MAP_FAILED) {
+                            ::close(f);
+                            return false;
+                        }
+                        p = static_cast<std::uint8_t *>(q);
+                        n = size;
+                        fd = f;
+                        path = file_path;
+                        return true;
+                    }
+#endif
+
+                    std::uint8_t *p;
+                    std::size_t n;
+                    int fd;
+                    std::string path;
+                };
+
+                template<std::size_t DigestBits, typename Mapped>
+                struct digest_table_slot {
+                    static_digest<DigestBits> key;
+                    Mapped value;
+                };
+
+                template<std::size_t DigestBits>
+                struct digest_table_slot<DigestBits, void> {
+                    static_digest<DigestBits> key;
+                };
+
+                /*!
+                 * @brief Open addressing hash table of static_digest keys, with optional trivially copyable
+                 * values stored inline next to them.
+                 *
+                 * The layout follows Swiss tables: slots come in groups of 16, each with 16 control octets
+                 * probed at once. The digest is its own hash: its first 64 bits pick the group (bits 7 and
+                 * up) and the 7 bits kept in the control octet. Groups are probed quadratically, and the
+                 * table grows at 7/8 load. Everything lives in one contiguous region: a 64-octet header,
+                 * the control octets and the slots, each section cache line aligned. The region has no
+                 * pointers in it, so a file mapping of it is a table which persists across runs, on hosts
+                 * with the same byte order.
+                 *
+                 * @tparam DigestBits
+                 * @tparam Mapped void for a set
+                 */
+                template<std::size_t DigestBits, typename Mapped>
+                class digest_table {
+                public:
+                    typedef static_digest<DigestBits> digest_type;
+                    typedef digest_table_slot<DigestBits, Mapped> slot_type;
+
+                    BOOST_STATIC_ASSERT(std::is_trivially_copyable<slot_type>::value);
+
+                    constexpr static const std::size_t group_width = digest_table_group::width;
+                    constexpr static const std::size_t alignment = digest_table_storage::alignment;
+
+                    constexpr static const std::uint32_t version = 1;
+                    constexpr static const std::uint32_t byte_order = 0x01020304;
+
+                    struct header_type {
+                        char magic[8];
+                        std::uint32_t version;
+                        std::uint32_t byte_order;
+                        std::uint32_t digest_bits;
+                        std::uint32_t slot_size;
+                        std::uint64_t capacity;
+                        std::uint64_t size;
+                        std::uint64_t tombstones;
+                        std::uint8_t reserved[16];
+                    };
+
+                    BOOST_STATIC_ASSERT(sizeof(header_type) == alignment);
+
+                    digest_table() {
+                        build(storage, group_width);
+                    }
+
+                    /*!
+                     * @brief Takes over the contents of other, which is left an empty in-memory table. Throws
+                     * std::bad_alloc if that one cannot be allocated.
+                     */
+                    digest_table(digest_table &&other) : digest_table() {
+                        storage.swap(other.storage);
+                    }
+
+                    digest_table &operator=(digest_table &&other) {
+                        if (this != &other) {
+                            digest_table_storage s;
+                            build(s, group_width);
+                            storage.swap(other.storage);
+                            other.storage.swap(s);
+                        }
+                        return *this;
+                    }
+
+                    digest_table(const digest_table &) = delete;
+                    digest_table &operator=(const digest_table &) = delete;
+
+                    /*!
+                     * @brief Number of slots needed to hold n digests without growing.
+                     */
+                    static std::size_t capacity_for(std::size_t n) {
+                        std::size_t c = group_width;
+                        while (max_load(c) < n) {
+                            c *= 2;
+                        }
+                        return c;
+                    }
+
+                    std::size_t size() const {
+                        return header().size;
+                    }
+
+                    std::size_t capacity() const {
+                        return header().capacity;
+                    }
+
+                    slot_type *find(const digest_type &d) const {
+                        const std::uint64_t h = hash(d);
+                        const std::size_t mask = capacity() / group_width - 1;
+                        std::size_t g = (h >> 7) & mask;
+                        for (std::size_t step = 1; step <= mask + 1; g = (g + step++) & mask) {
+                            const digest_table_group group(control() + g * group_width);
+                            for (std::uint32_t m = group.match(h2(h)); m; m &= m - 1) {
+                                slot_type *s = slot(g * group_width + lowest_bit(m));
+                                if (!std::memcmp(s->key.data(), d.data(), d.size())) {
+                                    return s;
+                                }
+                            }
+                            if (group.match_empty()) {
+                                break;
+                            }
+                        }
+                        return nullptr;
+                    }
+
+                    /*!
+                     * @brief Inserts d unless present. Throws if the table had to grow and could not.
+                     * @return Slot holding d and whether it was inserted
+                     */
+                    std::pair<slot_type *, bool> insert(const digest_type &d) {
+                        if (slot_type *s = find(d)) {
+                            return std::make_pair(s, false);
+                        }
+                        if (size() + header().tombstones >= max_load(capacity())) {
+                            // With enough of the load being tombstones, rebuilding at the same capacity reclaims them
+                            rehash(size() * 32 > capacity() * 25 ? capacity() * 2 : capacity());
+                        }
+                        return std::make_pair(place(storage, d), true);
+                    }
+
+                    bool erase(const digest_type &d) {
+                        slot_type *s = find(d);
+                        if (!s) {
+                            return false;
+                        }
+                        const std::size_t i = s - slot(0);
+                        // A probe stops at a group with an empty slot, so no probe continues past this one
+                        // when it has one and the slot can become empty instead of a tombstone
+                        if (digest_table_group(control() + i / group_width * group_width).match_empty()) {
+                            control()[i] = digest_table_group::empty;
+                        } else {
+                            control()[i] = digest_table_group::deleted;
+                            ++header().tombstones;
+                        }
+                        --header().size;
+                        return true;
+                    }
+
+                    void clear() {
+                        std::memset(control(), digest_table_group::empty, capacity());
+                        header().size = 0;
+                        header().tombstones = 0;
+                    }
+
+                    void reserve(std::size_t n) {
+                        if (capacity_for(n) > capacity()) {
+                            rehash(capacity_for(n));
+                        }
+                    }
+
+                    template<typename F>
+                    void for_each(F &&f) const {
+                        for (std::size_t i = 0; i != capacity(); ++i) {
+                            if (!(control()[i] & 0x80)) {
+                                f(*slot(i));
+                            }
+                        }
+                    }
+
+#ifdef BOOST_HAS_UNISTD_H
+                    /*!
+                     * @brief Maps the table stored at path, or creates one there able to hold n digests if the
+                     * file is missing or empty. The current contents are discarded.
+                     * @return false if the file could not be created or mapped, or does not hold a table of
+                     * this type; the table is left unchanged then
+                     */
+                    bool open(const std::string &path, std::size_t n) {
+                        digest_table_storage s;
+                        switch (s.map(path)) {
+                            case digest_table_storage::map_done:
+                                if (!valid(s)) {
+                                    return false;
+                                }
+                                break;
+                            case digest_table_storage::map_missing:
+                            case digest_table_storage::map_empty:
+                                if (!s.create(path, region_size(capacity_for(n)))) {
+                                    return false;
+                                }
+                                build(s, capacity_for(n));
+                                break;
+                            default:
+                                return false;
+                        }
+                        storage.swap(s);
+                        return true;
+                    }
+
+                    /*!
+                     * @brief Flushes a file backed table to its file.
+                     */
+                    bool sync() const {
+                        return storage.sync();
+                    }
+#endif
+
+                private:
+                    constexpr static std::size_t max_load(std::size_t c) {
+                        return c - c / 8;
+                    }
+
+                    constexpr static std::size_t control_size(std::size_t c) {
+                        return (c + alignment - 1) / alignment * alignment;
+                    }
+
+                    constexpr static std::size_t region_size(std::size_t c) {
+                        return sizeof(header_type) + control_size(c) + c * sizeof(slot_type);
+                    }
+
+                    static std::uint64_t hash(const digest_type &d) {
+                        std::uint64_t h = 0;
+                        std::memcpy(&h, d.data(), d.size() < sizeof(h) ? d.size() : sizeof(h));
+                        return h;
+                    }
+
+                    static std::uint8_t h2(std::uint64_t h) {
+                        return h & 0x7F;
+                    }
+
+                    static header_type &header(const digest_table_storage &s) {
+                        return *reinterpret_cast<header_type *>(s.data());
+                    }
+
+                    static std::uint8_t *control(const digest_table_storage &s) {
+                        return s.data() + sizeof(header_type);
+                    }
+
+                    static slot_type *slot(const digest_table_storage &s, std::size_t i) {
+                        return reinterpret_cast<slot_type *>(s.data() + sizeof(header_type) +
+                                                             control_size(header(s).capacity)) +
+                               i;
+                    }
+
+                    header_type &header() const {
+                        return header(storage);
+                    }
+
+                    std::uint8_t *control() const {
+                        return control(storage);
+                    }
+
+                    slot_type *slot(std::size_t i) const {
+                        return slot(storage, i);
+                    }
+
+                    /*!
+                     * @brief Initializes an empty table of c slots in s, which is region_size(c) octets.
+                     */
+                    static void build(digest_table_storage &s, std::size_t c) {
+                        if (!s.mapped()) {
+                            s.allocate(region_size(c));
+                        }
+                        header_type &h = header(s);
+                        std::memset(&h, 0, sizeof(h));
+                        std::memcpy(h.magic, "CR3DIDX", 8);
+                        h.version = version;
+                        h.byte_order = byte_order;
+                        h.digest_bits = DigestBits;
+                        h.slot_size = sizeof(slot_type);
+                        h.capacity = c;
+                        std::memset(control(s), digest_table_group::empty, control_size(c));
+                    }
+
+                    /*!
+                     * @brief Puts d, known to be absent, into the first free slot of its probe sequence.
+                     */
+                    static slot_type *place(digest_table_storage &s, const digest_type &d) {
+                        header_type &hdr = header(s);
+                        const std::uint64_t h = hash(d);
+                        const std::size_t mask = hdr.capacity / group_width - 1;
+                        std::size_t g = (h >> 7) & mask;
+                        std::uint32_t m;
+                        for (std::size_t step = 1;; g = (g + step++) & mask) {
+                            m = digest_table_group(control(s) + g * group_width).match_empty_or_deleted();
+                            if (m) {
+                                break;
+                            }
+                        }
+
+                        const std::size_t i = g * group_width + lowest_bit(m);
+                        if (control(s)[i] == digest_table_group::deleted) {
+                            --hdr.tombstones;
+                        }
+                        control(s)[i] = h2(h);
+                        slot_type *r = slot(s, i);
+                        std::memcpy(r->key.data(), d.data(), d.size());
+                        ++hdr.size;
+                        return r;
+                    }
+
+                    /*!
+                     * @brief Moves all digests into a new table of c slots, in memory or in a new file which
+                     * then replaces the old one.
+                     */
+                    void rehash(std::size_t c) {
+                        digest_table_storage s;
+#ifdef BOOST_HAS_UNISTD_H
+                        const std::string temporary = storage.file_path() + ".tmp";
+                        if (storage.mapped() && !s.create(temporary, region_size(c))) {
+                            throw std::system_error(errno, std::generic_category(), "digest_table: " + temporary);
+                        }
+#endif
+                        build(s, c);
+                        for_each([&s](const slot_type &old) {
+                            slot_type *r = place(s, old.key);
+                            std::memcpy(static_cast<void *>(r), &old, sizeof(slot_type));
+                        });
+#ifdef BOOST_HAS_UNISTD_H
+                        if (storage.mapped()) {
+                            if (!s.sync() || std::rename(temporary.c_str(), storage.file_path().c_str())) {
+                                const int e = errno;
+                                ::unlink(temporary.c_str());
+                                throw std::system_error(e, std::generic_category(), "digest_table: " + temporary);
+                            }
+                            s.set_file_path(storage.file_path());
+                        }
+#endif
+                        storage.swap(s);
+                    }
+
+#ifdef BOOST_HAS_UNISTD_H
+                    static bool valid(const digest_table_storage &s) {
+                        if (s.size() < sizeof(header_type)) {
+                            return false;
+                        }
+                        const header_type &h = header(s);
+                        const std::size_t c = h.capacity;
+                        return !std::memcmp(h.magic, "CR3DIDX", 8) && h.version == version &&
+                               h.byte_order == byte_order && h.digest_bits == DigestBits &&
+                               h.slot_size == sizeof(slot_type) && c >= group_width && !(c & (c - 1)) &&
+                               s.size() == region_size(c) && h.size + h.tombstones <= max_load(c);
+                    }
+#endif
+
+                    digest_table_storage storage;
+                };
+            }    // namespace detail
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_DETAIL_DIGEST_TABLE_HPP
@@ -0,0 +1,76 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_DETAIL_DISPATCHING_COMPRESSOR_HPP
+#define CRYPTO3_HASH_DETAIL_DISPATCHING_COMPRESSOR_HPP
+
+#include <cstddef>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                /*!
+                 * @brief Compressor which hands blocks to Kernel when the CPU supports it and to Compressor
+                 * otherwise. Kernel provides supported() and process_blocks(word_type *state, const word_type
+                 * *blocks, std::size_t n), computing the same compression function as Compressor, and
+                 * min_blocks, the shortest run it is faster on. Shorter runs go to Compressor.
+                 *
+                 * @tparam Compressor
+                 * @tparam Kernel
+                 */
+                template<typename Compressor, typename Kernel>
+                struct dispatching_compressor : public Compressor {
+                    typedef Compressor fallback_type;
+                    typedef Kernel kernel_type;
+
+                    typedef typename fallback_type::word_type word_type;
+                    typedef typename fallback_type::state_type state_type;
+                    typedef typename fallback_type::block_type block_type;
+
+                    inline static void process_block(state_type &state, const block_type &block) {
+                        if (kernel_type::min_blocks == 1 && kernel_type::supported()) {
+                            kernel_type::process_blocks(state.data(), block.data(), 1);
+                        } else {
+                            fallback_type::process_block(state, block);
+                        }
+                    }
+
+                    /*!
+                     * @brief Processes n consecutive blocks of block_words words each.
+                     */
+                    inline static void process_blocks(state_type &state, const word_type *blocks, std::size_t n) {
+                        if (n >= kernel_type::min_blocks && kernel_type::supported()) {
+                            kernel_type::process_blocks(state.data(), blocks, n);
+                        } else {
+                            fallback_type::process_blocks(state, blocks, n);
+                        }
+                    }
+                };
+            }    // namespace detail
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_DETAIL_DISPATCHING_COMPRESSOR_HPP
@@ -27,6 +27,7 @@
 #define CRYPTO3_HASH_HAIFA_CONSTRUCTION_HPP
 
 #include <nil/crypto3/hash/detail/nop_finalizer.hpp>
+#include <nil/crypto3/hash/detail/instrument.hpp>
 
 #include <nil/crypto3/detail/static_digest.hpp>
 #include <nil/crypto3/detail/pack.hpp>
@@ -97,25 +98,43 @@ namespace nil {
                 template<typename Integer = std::size_t>
                 inline haifa_construction &process_block(const block_type &block, Integer seen,
                                                          Integer finalization = 0) {
+                    CRYPTO3_HASH_INSTRUMENT_ADD(haifa_construction, blocks_compressed, 1);
+                    CRYPTO3_HASH_INSTRUMENT_TIME(haifa_construction, compression_ns);
                     compressor_functor::process_block(state_, block, seen, finalization);
                     return *this;
                 }
 
+                /*!
+                 * @brief Processes n consecutive non-final blocks of block_words words each in a single
+                 * compressor call.
+                 * @param seen Bits seen by the end of the first block
+                 */
+                template<typename Integer = std::size_t>
+                inline haifa_construction &process_blocks(const word_type *blocks, std::size_t n, Integer seen) {
+                    CRYPTO3_HASH_INSTRUMENT_ADD(haifa_construction, blocks_compressed, n);
+                    CRYPTO3_HASH_INSTRUMENT_TIME(haifa_construction, compression_ns);
+                    compressor_functor::process_blocks(state_, blocks, n, seen);
+                    return *this;
+                }
+
                 inline digest_type digest(const block_type &block = block_type(),
                                           std::size_t total_seen = length_type()) {
                     using namespace nil::crypto3::detail;
 
                     block_type b = block;
-                    // Process block if it is full
-                    if (total_seen && !(total_seen % block_bits))
-                        process_block(b, total_seen);
 
-                    // Pad last message block
+                    // Pad last message block. A full last block is left intact and compressed only once, as the
+                    // final one
                     padding_functor padding;
                     padding(b, total_seen);
 
                     // Process last block
                     process_block(b, total_seen, salt_value);
+                    // Only the last block of an empty message holds no message data
+                    if (!total_seen) {
+                        CRYPTO3_HASH_INSTRUMENT_ADD(haifa_construction, padding_blocks, 1);
+                    }
+                    CRYPTO3_HASH_INSTRUMENT_ADD(haifa_construction, finalizations, 1);
 
                     // Apply finalizer
                     finalizer_functor()(state_);
@@ -143,6 +162,14 @@ namespace nil {
                     reset(iv());
                 }
 
+                /*!
+                 * @brief Sets the chaining state verbatim to a value previously obtained from state(). Unlike
+                 * reset(s), the parameter block is not applied again.
+                 */
+                void restore(const state_type &s) {
+                    state_ = s;
+                }
+
                 state_type const &state() const {
                     return state_;
                 }
@@ -0,0 +1,278 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_DETAIL_INSTRUMENT_HPP
+#define CRYPTO3_HASH_DETAIL_INSTRUMENT_HPP
+
+/*!
+ * @file
+ * Hot-path counters for the block stream processor, the hash accumulator and the constructions. They are only
+ * compiled in if CRYPTO3_HASH_INSTRUMENT is defined (consistently, in every translation unit); otherwise the
+ * hooks below expand to nothing.
+ *
+ * Counters are kept per thread and per construction type, are named after the hash using the construction,
+ * and are summed over all live and finished threads by registry::totals() and registry::json(). Timers read
+ * std::chrono::steady_clock around every compression and packing call and so add tens of nanoseconds per
+ * block themselves.
+ */
+
+#ifdef CRYPTO3_HASH_INSTRUMENT
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+
+#include <boost/core/demangle.hpp>
+#include <boost/preprocessor/cat.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace instrument {
+                enum counter {
+                    /// Blocks passed to the compressor, padding blocks included
+                    blocks_compressed,
+                    /// Nanoseconds spent in the compressor
+                    compression_ns,
+                    /// Blocks packed from the input values into words by the block stream processor
+                    blocks_packed,
+                    /// Nanoseconds spent packing
+                    packing_ns,
+                    /// Message bits received by the hash accumulator
+                    bits_absorbed,
+                    /// Blocks compressed during finalization which hold padding only and no message data. A
+                    /// last block carrying the message tail counts in blocks_compressed only
+                    padding_blocks,
+                    /// Digests computed
+                    finalizations,
+                    counters_count
+                };
+
+                inline const char *counter_name(std::size_t c) {
+                    static const char *const names[counters_count] = {
+                        "blocks_compressed", "compression_ns", "blocks_packed", "packing_ns",
+                        "bits_absorbed",     "padding_blocks", "finalizations"};
+                    return names[c];
+                }
+
+                typedef std::array<std::uint64_t, counters_count> totals_type;
+
+                class registry;
+
+                /*!
+                 * @brief Counters of one thread for one construction. Only the owning thread writes them, so
+                 * a relaxed load and store, i.e. a plain add, is enough for other threads to read them.
+                 */
+                struct slot {
+                    explicit slot(std::type_index key);
+                    ~slot();
+
+                    inline void add(counter c, std::uint64_t n) {
+                        values[c].store(values[c].load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+                    }
+
+                    std::type_index key;
+                    std::array<std::atomic<std::uint64_t>, counters_count> values;
+                };
+
+                /*!
+                 * @brief Process-wide registry of the slots of all threads.
+                 */
+                class registry {
+                public:
+                    static registry &instance() {
+                        static registry r;
+                        return r;
+                    }
+
+                    /*!
+                     * @brief Sums the counters of live threads and of threads which have exited, per hash name.
+                     */
+                    std::map<std::string, totals_type> totals() const {
+                        std::lock_guard<std::mutex> lock(mutex);
+
+                        std::map<std::string, totals_type> r;
+                        for (const auto &t : retired) {
+                            accumulate(r[name_of(t.first)], t.second);
+                        }
+                        for (const slot *s : live) {
+                            totals_type values;
+                            for (std::size_t c = 0; c != counters_count; ++c) {
+                                values[c] = s->values[c].load(std::memory_order_relaxed);
+                            }
+                            accumulate(r[name_of(s->key)], values);
+                        }
+                        return r;
+                    }
+
+                    /*!
+                     * @brief Zeroes all counters. Increments racing with the reset on other threads may be lost.
+                     */
+                    void reset() {
+                        std::lock_guard<std::mutex> lock(mutex);
+
+                        retired.clear();
+                        for (slot *s : live) {
+                            for (std::atomic<std::uint64_t> &v : s->values) {
+                                v.store(0, std::memory_order_relaxed);
+                            }
+                        }
+                    }
+
+                    /*!
+                     * @brief Dumps totals() as {"hashes": {"<name>": {"<counter>": n, ...}, ...}}. Besides the
+                     * counters, every hash has "octets_absorbed", bits_absorbed / 8.
+                     */
+                    std::string json() const {
+                        std::map<std::string, totals_type> t = totals();
+
+                        std::ostringstream os;
+                        os << "{\"hashes\": {";
+                        for (auto it = t.begin(); it != t.end(); ++it) {
+                            os << (it == t.begin() ? "" : ", ") << "\"" << it->first << "\": {";
+                            for (std::size_t c = 0; c != counters_count; ++c) {
+                                os << "\"" << counter_name(c) << "\": " << it->second[c] << ", ";
+                            }
+                            os << "\"octets_absorbed\": " << it->second[bits_absorbed] / 8 << "}";
+                        }
+                        os << "}}";
+                        return os.str();
+                    }
+
+                    void name(std::type_index key, const std::string &n) {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        names[key] = n;
+                    }
+
+                    void attach(slot *s) {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        live.insert(s);
+                    }
+
+                    void detach(slot *s) {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        totals_type values;
+                        for (std::size_t c = 0; c != counters_count; ++c) {
+                            values[c] = s->values[c].load(std::memory_order_relaxed);
+                        }
+                        accumulate(retired[s->key], values);
+                        live.erase(s);
+                    }
+
+                protected:
+                    static void accumulate(totals_type &to, const totals_type &from) {
+                        for (std::size_t c = 0; c != counters_count; ++c) {
+                            to[c] += from[c];
+                        }
+                    }
+
+                    std::string name_of(std::type_index key) const {
+                        auto it = names.find(key);
+                        return it == names.end() ? boost::core::demangle(key.name()) : it->second;
+                    }
+
+                    mutable std::mutex mutex;
+                    std::set<slot *> live;
+                    std::map<std::type_index, totals_type> retired;
+                    std::map<std::type_index, std::string> names;
+                };
+
+                inline slot::slot(std::type_index key) : key(key) {
+                    for (std::atomic<std::uint64_t> &v : values) {
+                        v.store(0, std::memory_order_relaxed);
+                    }
+                    registry::instance().attach(this);
+                }
+
+                inline slot::~slot() {
+                    registry::instance().detach(this);
+                }
+
+                /*!
+                 * @brief The calling thread's counters for construction Key.
+                 */
+                template<typename Key>
+                inline slot &local() {
+                    thread_local slot s(typeid(Key));
+                    return s;
+                }
+
+                /*!
+                 * @brief Reports the counters of Key under the name of Hash. Done once per pair.
+                 */
+                template<typename Key, typename Hash>
+                inline void name() {
+                    static const bool named =
+                        (registry::instance().name(typeid(Key), boost::core::demangle(typeid(Hash).name())), true);
+                    (void)named;
+                }
+
+                template<typename Key>
+                class scoped_timer {
+                public:
+                    explicit scoped_timer(counter c) : c(c), start(std::chrono::steady_clock::now()) {
+                    }
+
+                    ~scoped_timer() {
+                        local<Key>().add(
+                            c, std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() -
+                                                                                     start)
+                                   .count());
+                    }
+
+                private:
+                    counter c;
+                    std::chrono::steady_clock::time_point start;
+                };
+            }    // namespace instrument
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace nil
+
+#define CRYPTO3_HASH_INSTRUMENT_ADD(Key, Counter, N) \
+    ::nil::crypto3::hashes::instrument::local<Key>().add(::nil::crypto3::hashes::instrument::Counter, (N))
+
+#define CRYPTO3_HASH_INSTRUMENT_TIME(Key, Counter)                                       \
+    ::nil::crypto3::hashes::instrument::scoped_timer<Key> BOOST_PP_CAT(crypto3_hash_timer_, __LINE__)( \
+        ::nil::crypto3::hashes::instrument::Counter)
+
+#define CRYPTO3_HASH_INSTRUMENT_NAME(Key, Hash) ::nil::crypto3::hashes::instrument::name<Key, Hash>()
+
+#else
+
+#define CRYPTO3_HASH_INSTRUMENT_ADD(Key, Counter, N)
+#define CRYPTO3_HASH_INSTRUMENT_TIME(Key, Counter)
+#define CRYPTO3_HASH_INSTRUMENT_NAME(Key, Hash)
+
+#endif    // CRYPTO3_HASH_INSTRUMENT
+
+#endif    // CRYPTO3_HASH_DETAIL_INSTRUMENT_HPP
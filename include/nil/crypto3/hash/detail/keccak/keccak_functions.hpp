@@ -54,7 +54,7 @@ namespace nil {
                         UINT64_C(0x000000000000800a), UINT64_C(0x800000008000000a), UINT64_C(0x8000000080008081),
                         UINT64_C(0x8000000000008080), UINT64_C(0x0000000080000001), UINT64_C(0x8000000080008008)};
 
-                    static inline void permute(state_type &A) {
+                    constexpr static inline void permute(state_type &A) {
                         for (typename round_constants_type::value_type c : round_constants) {
                             const word_type C0 = A[0] ^ A[5] ^ A[10] ^ A[15] ^ A[20];
                             const word_type C1 = A[1] ^ A[6] ^ A[11] ^ A[16] ^ A[21];
@@ -27,6 +27,7 @@
 #define CRYPTO3_HASH_MERKLE_DAMGARD_CONSTRUCTION_HPP
 
 #include <nil/crypto3/hash/detail/nop_finalizer.hpp>
+#include <nil/crypto3/hash/detail/instrument.hpp>
 
 #include <nil/crypto3/detail/static_digest.hpp>
 #include <nil/crypto3/detail/pack.hpp>
@@ -90,10 +91,26 @@ namespace nil {
             public:
                 template<typename Integer = std::size_t>
                 inline merkle_damgard_construction &process_block(const block_type &block, Integer seen = Integer()) {
+                    CRYPTO3_HASH_INSTRUMENT_ADD(merkle_damgard_construction, blocks_compressed, 1);
+                    CRYPTO3_HASH_INSTRUMENT_TIME(merkle_damgard_construction, compression_ns);
                     compressor_functor::process_block(state_, block);
                     return *this;
                 }
 
+                /*!
+                 * @brief Processes n consecutive blocks of block_words words each in a single compressor call.
+                 * The bit count argument is ignored, it keeps the signature in line with
+                 * haifa_construction::process_blocks.
+                 */
+                template<typename Integer = std::size_t>
+                inline merkle_damgard_construction &process_blocks(const word_type *blocks, std::size_t n,
+                                                                   Integer = Integer()) {
+                    CRYPTO3_HASH_INSTRUMENT_ADD(merkle_damgard_construction, blocks_compressed, n);
+                    CRYPTO3_HASH_INSTRUMENT_TIME(merkle_damgard_construction, compression_ns);
+                    compressor_functor::process_blocks(state_, blocks, n);
+                    return *this;
+                }
+
                 inline digest_type digest(const block_type &block = block_type(),
                                           length_type total_seen = length_type()) {
                     using namespace nil::crypto3::detail;
@@ -112,6 +129,10 @@ namespace nil {
                     if (block_seen + length_bits > block_bits) {
                         process_block(b);
                         std::fill(b.begin(), b.end(), 0);
+                        // The last block now holds padding and length only
+                        CRYPTO3_HASH_INSTRUMENT_ADD(merkle_damgard_construction, padding_blocks, 1);
+                    } else if (!(total_seen % block_bits)) {
+                        CRYPTO3_HASH_INSTRUMENT_ADD(merkle_damgard_construction, padding_blocks, 1);
                     }
 
                     // Append total length to the last block
@@ -119,13 +140,17 @@ namespace nil {
 
                     // Process the last block
                     process_block(b);
+                    CRYPTO3_HASH_INSTRUMENT_ADD(merkle_damgard_construction, finalizations, 1);
 
                     // Apply finalizer
                     finalizer_functor()(state_);
 
-                    // Convert digest to byte representation
+                    // Convert digest to byte representation, truncating the state for wide pipe hashes
+                    std::array<octet_type, state_bits / octet_bits> d_full;
+                    pack_from<endian_type, word_bits, octet_bits>(state_.begin(), state_.end(), d_full.begin());
+
                     digest_type d;
-                    pack_from<endian_type, word_bits, octet_bits>(state_.begin(), state_.end(), d.begin());
+                    std::copy(d_full.begin(), d_full.begin() + digest_bytes, d.begin());
                     return d;
                 }
 
@@ -142,6 +167,13 @@ namespace nil {
                     reset(iv());
                 }
 
+                /*!
+                 * @brief Sets the chaining state verbatim to a value previously obtained from state().
+                 */
+                inline void restore(const state_type &s) {
+                    state_ = s;
+                }
+
                 inline const state_type &state() const {
                     return state_;
                 }
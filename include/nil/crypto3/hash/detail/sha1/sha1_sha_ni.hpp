@@ -0,0 +1,124 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_DETAIL_SHA1_SHA_NI_HPP
+#define CRYPTO3_HASH_DETAIL_SHA1_SHA_NI_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include <nil/crypto3/detail/cpuid.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+#ifdef CRYPTO3_HAS_SHA_NI
+                /*!
+                 * @brief SHA-1 compression with the SHA extensions. sha1rnds4 performs four rounds on ABCD, taking
+                 * E folded into the message words by sha1nexte; sha1msg1/sha1msg2 extend the schedule.
+                 */
+                struct sha1_sha_ni {
+                    typedef std::uint32_t word_type;
+
+                    constexpr static const std::size_t min_blocks = 1;
+
+                    static bool supported() {
+                        return ::nil::crypto3::detail::cpuid::has_sha() &&
+                               ::nil::crypto3::detail::cpuid::has_sse41();
+                    }
+
+                    /*!
+                     * @brief Compresses n blocks of 16 words each into the state a..e.
+                     */
+                    BOOST_ATTRIBUTE_TARGET("sha,sse4.1")
+                    static void process_blocks(word_type *state, const word_type *blocks, std::size_t n) {
+                        // Word a in the highest lane, as the instructions expect, and the same for the message
+                        __m128i abcd = _mm_loadu_si128(reinterpret_cast<const __m128i *>(state));
+                        abcd = _mm_shuffle_epi32(abcd, 0x1B);
+                        __m128i e0 = _mm_set_epi32(static_cast<int>(state[4]), 0, 0, 0), e1 = e0;
+
+                        for (; n; --n, blocks += 16) {
+                            const __m128i abcd_saved = abcd, e_saved = e0;
+
+                            __m128i m[4];
+                            for (std::size_t i = 0; i != 4; ++i) {
+                                m[i] = _mm_shuffle_epi32(
+                                    _mm_loadu_si128(reinterpret_cast<const __m128i *>(blocks + 4 * i)), 0x1B);
+                            }
+
+                            steps(abcd, e0, e1, m, std::integral_constant<std::size_t, 0>());
+
+                            e0 = _mm_sha1nexte_epu32(e0, e_saved);
+                            abcd = _mm_add_epi32(abcd, abcd_saved);
+                        }
+
+                        _mm_storeu_si128(reinterpret_cast<__m128i *>(state), _mm_shuffle_epi32(abcd, 0x1B));
+                        state[4] = static_cast<word_type>(_mm_extract_epi32(e0, 3));
+                    }
+
+                protected:
+                    /*!
+                     * @brief Rounds 4 * I .. 79, four per step, alternating e0 and e1 as the E operand, the
+                     * schedule running three steps ahead. Steps are unrolled at compile time, sha1rnds4 takes the
+                     * round function as an immediate.
+                     */
+                    template<std::size_t I>
+                    BOOST_ATTRIBUTE_TARGET("sha,sse4.1")
+                    static inline void steps(__m128i &abcd, __m128i &e0, __m128i &e1, __m128i *m,
+                                             std::integral_constant<std::size_t, I>) {
+                        const __m128i &w = m[I % 4];
+                        if (I % 2) {
+                            e1 = _mm_sha1nexte_epu32(e1, w);
+                            e0 = abcd;
+                        } else {
+                            e0 = I ? _mm_sha1nexte_epu32(e0, w) : _mm_add_epi32(e0, w);
+                            e1 = abcd;
+                        }
+                        if (I >= 3 && I < 19) {
+                            m[(I + 1) % 4] = _mm_sha1msg2_epu32(m[(I + 1) % 4], w);
+                        }
+                        abcd = _mm_sha1rnds4_epu32(abcd, I % 2 ? e1 : e0, I / 5);
+                        if (I >= 1 && I < 17) {
+                            m[(I + 3) % 4] = _mm_sha1msg1_epu32(m[(I + 3) % 4], w);
+                        }
+                        if (I >= 2 && I < 18) {
+                            m[(I + 2) % 4] = _mm_xor_si128(m[(I + 2) % 4], w);
+                        }
+
+                        steps(abcd, e0, e1, m, std::integral_constant<std::size_t, I + 1>());
+                    }
+
+                    static inline void steps(__m128i &, __m128i &, __m128i &, __m128i *,
+                                             std::integral_constant<std::size_t, 20>) {
+                    }
+                };
+#endif
+            }    // namespace detail
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_DETAIL_SHA1_SHA_NI_HPP
@@ -0,0 +1,81 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_DETAIL_SHA256D_FINALIZER_HPP
+#define CRYPTO3_HASH_DETAIL_SHA256D_FINALIZER_HPP
+
+#include <array>
+
+#include <nil/crypto3/hash/detail/sha2/sha2_policy.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                /*!
+                 * @brief Second pass of SHA-256d. The chaining state of the first pass is the 32-octet message of
+                 * the second one, so its only block is the eight state words followed by a constant padding,
+                 * compressed from the SHA-256 initial state. No digest octets are produced in between.
+                 * @tparam Compressor SHA-256 compressor
+                 */
+                template<typename Compressor>
+                struct sha256d_finalizer {
+                    typedef sha2_policy<256> policy_type;
+
+                    typedef typename Compressor::word_type word_type;
+                    typedef typename Compressor::state_type state_type;
+                    typedef typename Compressor::block_type block_type;
+
+                    constexpr static const std::size_t state_words = Compressor::state_words;
+                    constexpr static const std::size_t padding_words = Compressor::block_words - state_words;
+                    typedef std::array<word_type, padding_words> padding_type;
+
+                    /*!
+                     * @brief Block words 8 to 15: a one bit, zeros and the length of 256 bits.
+                     */
+                    constexpr static const padding_type padding = {{0x80000000, 0, 0, 0, 0, 0, 0, 0x100}};
+
+                    void operator()(state_type &state) const {
+                        block_type block;
+                        for (std::size_t i = 0; i != state_words; ++i) {
+                            block[i] = state[i];
+                        }
+                        for (std::size_t i = 0; i != padding_words; ++i) {
+                            block[state_words + i] = padding[i];
+                        }
+
+                        state = policy_type::initial_state;
+                        Compressor::process_block(state, block);
+                    }
+                };
+
+                template<typename Compressor>
+                constexpr typename sha256d_finalizer<Compressor>::padding_type const
+                    sha256d_finalizer<Compressor>::padding;
+            }    // namespace detail
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_DETAIL_SHA256D_FINALIZER_HPP
@@ -0,0 +1,400 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_DETAIL_SHA2_256_LANES_HPP
+#define CRYPTO3_HASH_DETAIL_SHA2_256_LANES_HPP
+
+#include <cstdint>
+#include <cstring>
+
+#include <nil/crypto3/detail/cpuid.hpp>
+#include <nil/crypto3/detail/octet.hpp>
+
+#include <nil/crypto3/hash/detail/sha2/sha2_functions.hpp>
+#include <nil/crypto3/hash/detail/sha2/sha2_compressor.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                /*!
+                 * @brief SHA-256 compression of several independent messages in lockstep. Kernels share one
+                 * interface: the chaining states of all lanes are stored word-major, i.e. word i of lane l is
+                 * state[i * lanes + l], and blocks[l] points to the 64 octets of the block for lane l.
+                 * compress_schedule() compresses the same block in every lane from its precomputed message
+                 * schedule, wk[t] being schedule word t plus round constant t, e.g. a constant padding block.
+                 */
+                struct sha2_256_scalar_lanes {
+                    typedef sha2_functions<256> functions_type;
+                    typedef functions_type::word_type word_type;
+
+                    constexpr static const std::size_t lanes = 1;
+
+                    static bool supported() {
+                        return true;
+                    }
+
+                    static inline word_type load_be(const octet_type *p) {
+                        return (static_cast<word_type>(p[0]) << 24) | (static_cast<word_type>(p[1]) << 16) |
+                               (static_cast<word_type>(p[2]) << 8) | static_cast<word_type>(p[3]);
+                    }
+
+                    static void compress(word_type *state, const octet_type *const *blocks) {
+                        word_type w[16];
+                        for (std::size_t i = 0; i != 16; ++i) {
+                            w[i] = load_be(blocks[0] + 4 * i);
+                        }
+
+                        word_type a = state[0], b = state[1], c = state[2], d = state[3], e = state[4],
+                                  f = state[5], g = state[6], h = state[7];
+
+                        for (std::size_t i = 0; i != functions_type::rounds; ++i) {
+                            if (i >= 16) {
+                                w[i & 15] += functions_type::sigma_1(w[(i - 2) & 15]) + w[(i - 7) & 15] +
+                                             functions_type::sigma_0(w[(i - 15) & 15]);
+                            }
+
+                            word_type t1 = h + functions_type::Sigma_1(e) + functions_type::ch(e, f, g) +
+                                           functions_type::round_constants[i] + w[i & 15];
+                            word_type t2 = functions_type::Sigma_0(a) + functions_type::maj(a, b, c);
+
+                            h = g;
+                            g = f;
+                            f = e;
+                            e = d + t1;
+                            d = c;
+                            c = b;
+                            b = a;
+                            a = t1 + t2;
+                        }
+
+                        state[0] += a;
+                        state[1] += b;
+                        state[2] += c;
+                        state[3] += d;
+                        state[4] += e;
+                        state[5] += f;
+                        state[6] += g;
+                        state[7] += h;
+                    }
+
+                    static void compress_schedule(word_type *state, const word_type *wk) {
+                        sha2_compressor<256>::state_type s;
+                        std::memcpy(s.data(), state, sizeof(s));
+                        sha2_compressor<256>::process_schedule(s, wk);
+                        std::memcpy(state, s.data(), sizeof(s));
+                    }
+                };
+
+#ifdef CRYPTO3_HAS_X86_INTRINSICS
+                struct sha2_256_avx2_lanes {
+                    typedef sha2_functions<256> functions_type;
+                    typedef functions_type::word_type word_type;
+
+                    constexpr static const std::size_t lanes = 8;
+
+                    static bool supported() {
+                        return ::nil::crypto3::detail::cpuid::has_avx2();
+                    }
+
+                    /*!
+                     * @brief Loads eight consecutive big-endian words of lanes 0..7 starting at offset and
+                     * transposes them, so that out[j] holds word j of every lane.
+                     */
+                    BOOST_ATTRIBUTE_TARGET("avx2")
+                    static inline void load_transposed(const octet_type *const *blocks, std::size_t offset,
+                                                       __m256i *out) {
+                        const __m256i bswap = _mm256_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3,
+                                                              12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+                        __m256i r[8];
+                        for (std::size_t l = 0; l != 8; ++l) {
+                            r[l] = _mm256_shuffle_epi8(
+                                _mm256_loadu_si256(reinterpret_cast<const __m256i *>(blocks[l] + offset)), bswap);
+                        }
+
+                        __m256i t0 = _mm256_unpacklo_epi32(r[0], r[1]), t1 = _mm256_unpackhi_epi32(r[0], r[1]);
+                        __m256i t2 = _mm256_unpacklo_epi32(r[2], r[3]), t3 = _mm256_unpackhi_epi32(r[2], r[3]);
+                        __m256i t4 = _mm256_unpacklo_epi32(r[4], r[5]), t5 = _mm256_unpackhi_epi32(r[4], r[5]);
+                        __m256i t6 = _mm256_unpacklo_epi32(r[6], r[7]), t7 = _mm256_unpackhi_epi32(r[6], r[7]);
+
+                        __m256i u0 = _mm256_unpacklo_epi64(t0, t2), u1 = _mm256_unpackhi_epi64(t0, t2);
+                        __m256i u2 = _mm256_unpacklo_epi64(t1, t3), u3 = _mm256_unpackhi_epi64(t1, t3);
+                        __m256i u4 = _mm256_unpacklo_epi64(t4, t6), u5 = _mm256_unpackhi_epi64(t4, t6);
+                        __m256i u6 = _mm256_unpacklo_epi64(t5, t7), u7 = _mm256_unpackhi_epi64(t5, t7);
+
+                        out[0] = _mm256_permute2x128_si256(u0, u4, 0x20);
+                        out[1] = _mm256_permute2x128_si256(u1, u5, 0x20);
+                        out[2] = _mm256_permute2x128_si256(u2, u6, 0x20);
+                        out[3] = _mm256_permute2x128_si256(u3, u7, 0x20);
+                        out[4] = _mm256_permute2x128_si256(u0, u4, 0x31);
+                        out[5] = _mm256_permute2x128_si256(u1, u5, 0x31);
+                        out[6] = _mm256_permute2x128_si256(u2, u6, 0x31);
+                        out[7] = _mm256_permute2x128_si256(u3, u7, 0x31);
+                    }
+
+                    template<int N>
+                    BOOST_ATTRIBUTE_TARGET("avx2")
+                    static inline __m256i rotr(__m256i x) {
+                        return _mm256_or_si256(_mm256_srli_epi32(x, N), _mm256_slli_epi32(x, 32 - N));
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("avx2")
+                    static void compress(word_type *state, const octet_type *const *blocks) {
+                        __m256i w[16];
+                        load_transposed(blocks, 0, w);
+                        load_transposed(blocks, 32, w + 8);
+
+                        __m256i s[8];
+                        for (std::size_t i = 0; i != 8; ++i) {
+                            s[i] = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(state + i * lanes));
+                        }
+                        __m256i a = s[0], b = s[1], c = s[2], d = s[3], e = s[4], f = s[5], g = s[6], h = s[7];
+
+                        for (std::size_t i = 0; i != functions_type::rounds; ++i) {
+                            if (i >= 16) {
+                                __m256i w2 = w[(i - 2) & 15], w15 = w[(i - 15) & 15];
+                                __m256i s1 = _mm256_xor_si256(_mm256_xor_si256(rotr<17>(w2), rotr<19>(w2)),
+                                                              _mm256_srli_epi32(w2, 10));
+                                __m256i s0 = _mm256_xor_si256(_mm256_xor_si256(rotr<7>(w15), rotr<18>(w15)),
+                                                              _mm256_srli_epi32(w15, 3));
+                                w[i & 15] = _mm256_add_epi32(_mm256_add_epi32(w[i & 15], s1),
+                                                             _mm256_add_epi32(w[(i - 7) & 15], s0));
+                            }
+
+                            __m256i S1 = _mm256_xor_si256(_mm256_xor_si256(rotr<6>(e), rotr<11>(e)), rotr<25>(e));
+                            __m256i ch = _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g));
+                            __m256i t1 = _mm256_add_epi32(
+                                _mm256_add_epi32(_mm256_add_epi32(h, S1), _mm256_add_epi32(ch, w[i & 15])),
+                                _mm256_set1_epi32(static_cast<int>(functions_type::round_constants[i])));
+
+                            __m256i S0 = _mm256_xor_si256(_mm256_xor_si256(rotr<2>(a), rotr<13>(a)), rotr<22>(a));
+                            __m256i maj =
+                                _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(c, _mm256_or_si256(a, b)));
+                            __m256i t2 = _mm256_add_epi32(S0, maj);
+
+                            h = g;
+                            g = f;
+                            f = e;
+                            e = _mm256_add_epi32(d, t1);
+                            d = c;
+                            c = b;
+                            b = a;
+                            a = _mm256_add_epi32(t1, t2);
+                        }
+
+                        s[0] = _mm256_add_epi32(s[0], a);
+                        s[1] = _mm256_add_epi32(s[1], b);
+                        s[2] = _mm256_add_epi32(s[2], c);
+                        s[3] = _mm256_add_epi32(s[3], d);
+                        s[4] = _mm256_add_epi32(s[4], e);
+                        s[5] = _mm256_add_epi32(s[5], f);
+                        s[6] = _mm256_add_epi32(s[6], g);
+                        s[7] = _mm256_add_epi32(s[7], h);
+                        for (std::size_t i = 0; i != 8; ++i) {
+                            _mm256_storeu_si256(reinterpret_cast<__m256i *>(state + i * lanes), s[i]);
+                        }
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("avx2")
+                    static void compress_schedule(word_type *state, const word_type *wk) {
+                        __m256i s[8];
+                        for (std::size_t i = 0; i != 8; ++i) {
+                            s[i] = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(state + i * lanes));
+                        }
+                        __m256i a = s[0], b = s[1], c = s[2], d = s[3], e = s[4], f = s[5], g = s[6], h = s[7];
+
+                        for (std::size_t i = 0; i != functions_type::rounds; ++i) {
+                            __m256i S1 = _mm256_xor_si256(_mm256_xor_si256(rotr<6>(e), rotr<11>(e)), rotr<25>(e));
+                            __m256i ch = _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g));
+                            __m256i k = _mm256_set1_epi32(static_cast<int>(wk[i]));
+                            __m256i t1 = _mm256_add_epi32(_mm256_add_epi32(h, S1), _mm256_add_epi32(ch, k));
+
+                            __m256i S0 = _mm256_xor_si256(_mm256_xor_si256(rotr<2>(a), rotr<13>(a)), rotr<22>(a));
+                            __m256i maj =
+                                _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(c, _mm256_or_si256(a, b)));
+                            __m256i t2 = _mm256_add_epi32(S0, maj);
+
+                            h = g;
+                            g = f;
+                            f = e;
+                            e = _mm256_add_epi32(d, t1);
+                            d = c;
+                            c = b;
+                            b = a;
+                            a = _mm256_add_epi32(t1, t2);
+                        }
+
+                        s[0] = _mm256_add_epi32(s[0], a);
+                        s[1] = _mm256_add_epi32(s[1], b);
+                        s[2] = _mm256_add_epi32(s[2], c);
+                        s[3] = _mm256_add_epi32(s[3], d);
+                        s[4] = _mm256_add_epi32(s[4], e);
+                        s[5] = _mm256_add_epi32(s[5], f);
+                        s[6] = _mm256_add_epi32(s[6], g);
+                        s[7] = _mm256_add_epi32(s[7], h);
+                        for (std::size_t i = 0; i != 8; ++i) {
+                            _mm256_storeu_si256(reinterpret_cast<__m256i *>(state + i * lanes), s[i]);
+                        }
+                    }
+                };
+
+                struct sha2_256_avx512_lanes {
+                    typedef sha2_functions<256> functions_type;
+                    typedef functions_type::word_type word_type;
+
+                    constexpr static const std::size_t lanes = 16;
+
+                    static bool supported() {
+                        return ::nil::crypto3::detail::cpuid::has_avx512f();
+                    }
+
+                    // The zero-masking forms of ror, srli and inserti64x4 are used throughout: the plain ones
+                    // merge into an undefined vector, which GCC reports as used uninitialized
+                    template<int N>
+                    BOOST_ATTRIBUTE_TARGET("avx512f")
+                    static inline __m512i rotr(__m512i x) {
+                        return _mm512_maskz_ror_epi32(0xffff, x, N);
+                    }
+
+                    template<int N>
+                    BOOST_ATTRIBUTE_TARGET("avx512f")
+                    static inline __m512i shr(__m512i x) {
+                        return _mm512_maskz_srli_epi32(0xffff, x, N);
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("avx512f")
+                    static inline __m512i xor3(__m512i x, __m512i y, __m512i z) {
+                        return _mm512_ternarylogic_epi32(x, y, z, 0x96);
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("avx512f")
+                    static void compress(word_type *state, const octet_type *const *blocks) {
+                        __m512i w[16];
+                        for (std::size_t half = 0; half != 2; ++half) {
+                            __m256i lo[8], hi[8];
+                            sha2_256_avx2_lanes::load_transposed(blocks, half * 32, lo);
+                            sha2_256_avx2_lanes::load_transposed(blocks + 8, half * 32, hi);
+                            for (std::size_t j = 0; j != 8; ++j) {
+                                __m512i v = _mm512_maskz_inserti64x4(0xff, _mm512_setzero_si512(), lo[j], 0);
+                                w[half * 8 + j] = _mm512_maskz_inserti64x4(0xff, v, hi[j], 1);
+                            }
+                        }
+
+                        __m512i s[8];
+                        for (std::size_t i = 0; i != 8; ++i) {
+                            s[i] = _mm512_loadu_si512(state + i * lanes);
+                        }
+                        __m512i a = s[0], b = s[1], c = s[2], d = s[3], e = s[4], f = s[5], g = s[6], h = s[7];
+
+                        for (std::size_t i = 0; i != functions_type::rounds; ++i) {
+                            if (i >= 16) {
+                                __m512i w2 = w[(i - 2) & 15], w15 = w[(i - 15) & 15];
+                                __m512i s1 = xor3(rotr<17>(w2), rotr<19>(w2), shr<10>(w2));
+                                __m512i s0 = xor3(rotr<7>(w15), rotr<18>(w15), shr<3>(w15));
+                                w[i & 15] = _mm512_add_epi32(_mm512_add_epi32(w[i & 15], s1),
+                                                             _mm512_add_epi32(w[(i - 7) & 15], s0));
+                            }
+
+                            __m512i S1 = xor3(rotr<6>(e), rotr<11>(e), rotr<25>(e));
+                            __m512i ch = _mm512_ternarylogic_epi32(e, f, g, 0xca);
+                            __m512i t1 = _mm512_add_epi32(
+                                _mm512_add_epi32(_mm512_add_epi32(h, S1), _mm512_add_epi32(ch, w[i & 15])),
+                                _mm512_set1_epi32(static_cast<int>(functions_type::round_constants[i])));
+
+                            __m512i S0 = xor3(rotr<2>(a), rotr<13>(a), rotr<22>(a));
+                            __m512i maj = _mm512_ternarylogic_epi32(a, b, c, 0xe8);
+                            __m512i t2 = _mm512_add_epi32(S0, maj);
+
+                            h = g;
+                            g = f;
+                            f = e;
+                            e = _mm512_add_epi32(d, t1);
+                            d = c;
+                            c = b;
+                            b = a;
+                            a = _mm512_add_epi32(t1, t2);
+                        }
+
+                        s[0] = _mm512_add_epi32(s[0], a);
+                        s[1] = _mm512_add_epi32(s[1], b);
+                        s[2] = _mm512_add_epi32(s[2], c);
+                        s[3] = _mm512_add_epi32(s[3], d);
+                        s[4] = _mm512_add_epi32(s[4], e);
+                        s[5] = _mm512_add_epi32(s[5], f);
+                        s[6] = _mm512_add_epi32(s[6], g);
+                        s[7] = _mm512_add_epi32(s[7], h);
+                        for (std::size_t i = 0; i != 8; ++i) {
+                            _mm512_storeu_si512(state + i * lanes, s[i]);
+                        }
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("avx512f")
+                    static void compress_schedule(word_type *state, const word_type *wk) {
+                        __m512i s[8];
+                        for (std::size_t i = 0; i != 8; ++i) {
+                            s[i] = _mm512_loadu_si512(state + i * lanes);
+                        }
+                        __m512i a = s[0], b = s[1], c = s[2], d = s[3], e = s[4], f = s[5], g = s[6], h = s[7];
+
+                        for (std::size_t i = 0; i != functions_type::rounds; ++i) {
+                            __m512i S1 = xor3(rotr<6>(e), rotr<11>(e), rotr<25>(e));
+                            __m512i ch = _mm512_ternarylogic_epi32(e, f, g, 0xca);
+                            __m512i k = _mm512_set1_epi32(static_cast<int>(wk[i]));
+                            __m512i t1 = _mm512_add_epi32(_mm512_add_epi32(h, S1), _mm512_add_epi32(ch, k));
+
+                            __m512i S0 = xor3(rotr<2>(a), rotr<13>(a), rotr<22>(a));
+                            __m512i maj = _mm512_ternarylogic_epi32(a, b, c, 0xe8);
+                            __m512i t2 = _mm512_add_epi32(S0, maj);
+
+                            h = g;
+                            g = f;
+                            f = e;
+                            e = _mm512_add_epi32(d, t1);
+                            d = c;
+                            c = b;
+                            b = a;
+                            a = _mm512_add_epi32(t1, t2);
+                        }
+
+                        s[0] = _mm512_add_epi32(s[0], a);
+                        s[1] = _mm512_add_epi32(s[1], b);
+                        s[2] = _mm512_add_epi32(s[2], c);
+                        s[3] = _mm512_add_epi32(s[3], d);
+                        s[4] = _mm512_add_epi32(s[4], e);
+                        s[5] = _mm512_add_epi32(s[5], f);
+                        s[6] = _mm512_add_epi32(s[6], g);
+                        s[7] = _mm512_add_epi32(s[7], h);
+                        for (std::size_t i = 0; i != 8; ++i) {
+                            _mm512_storeu_si512(state + i * lanes, s[i]);
+                        }
+                    }
+                };
+#endif
+            }    // namespace detail
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_DETAIL_SHA2_256_LANES_HPP
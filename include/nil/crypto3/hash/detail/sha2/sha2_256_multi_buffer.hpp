@@ -0,0 +1,233 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_DETAIL_SHA2_256_MULTI_BUFFER_HPP
+#define CRYPTO3_HASH_DETAIL_SHA2_256_MULTI_BUFFER_HPP
+
+#include <array>
+#include <cstring>
+#include <cstdint>
+
+#include <boost/static_assert.hpp>
+
+#include <nil/crypto3/detail/static_digest.hpp>
+
+#include <nil/crypto3/hash/detail/sha2/sha2_policy.hpp>
+#include <nil/crypto3/hash/detail/sha2/sha2_256_lanes.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                /*!
+                 * @brief Multi-buffer SHA-224/256. Messages are distributed over the lanes of a kernel. Every
+                 * lane walks through the whole blocks of its message straight from the caller's memory, then
+                 * through one or two padded tail blocks. Whenever a lane finishes, it picks up the next pending
+                 * message, so messages of different lengths keep all lanes busy.
+                 *
+                 * With Passes > 1, e.g. for SHA-256d, a lane that finished a pass hashes the 32-octet result
+                 * again as one more padded block before it moves on, without leaving the lockstep loop.
+                 *
+                 * @tparam DigestBits 224 or 256
+                 * @tparam Passes number of times SHA-256 is applied, more than one only with 256
+                 */
+                template<std::size_t DigestBits, std::size_t Passes = 1>
+                struct sha2_256_multi_buffer {
+                    BOOST_STATIC_ASSERT(Passes && (Passes == 1 || DigestBits == 256));
+
+                    typedef sha2_policy<DigestBits> policy_type;
+                    typedef typename policy_type::digest_type digest_type;
+
+                    typedef sha2_functions<256>::word_type word_type;
+
+                    constexpr static const std::size_t state_words = policy_type::state_words;
+                    constexpr static const std::size_t block_octets = policy_type::block_bits / octet_bits;
+                    constexpr static const std::size_t length_octets = policy_type::length_bits / octet_bits;
+                    constexpr static const std::size_t digest_words = DigestBits / policy_type::word_bits;
+                    constexpr static const std::size_t word_octets = policy_type::word_bits / octet_bits;
+
+                    /*!
+                     * @brief Hashes count messages with the best kernel supported by the CPU.
+                     */
+                    static void process(const octet_type *const *messages, const std::size_t *sizes,
+                                        std::size_t count, digest_type *digests) {
+#ifdef CRYPTO3_HAS_X86_INTRINSICS
+                        if (count > sha2_256_avx2_lanes::lanes && sha2_256_avx512_lanes::supported()) {
+                            return process<sha2_256_avx512_lanes>(messages, sizes, count, digests);
+                        }
+                        if (count > 1 && sha2_256_avx2_lanes::supported()) {
+                            return process<sha2_256_avx2_lanes>(messages, sizes, count, digests);
+                        }
+#endif
+                        process<sha2_256_scalar_lanes>(messages, sizes, count, digests);
+                    }
+
+                    template<typename Kernel>
+                    static void process(const octet_type *const *messages, const std::size_t *sizes,
+                                        std::size_t count, digest_type *digests) {
+                        constexpr static const std::size_t lanes = Kernel::lanes;
+
+                        lane_type lane[lanes];
+                        alignas(64) word_type state[state_words * lanes] = {};
+                        const octet_type *blocks[lanes];
+                        const std::array<octet_type, block_octets> idle = {};
+
+                        std::size_t next = 0, active = 0;
+                        for (std::size_t l = 0; l != lanes; ++l) {
+                            lane[l].active = next != count;
+                            if (lane[l].active) {
+                                start(lane[l], next++, messages, sizes, state + l, lanes);
+                                ++active;
+                            }
+                        }
+
+                        while (active) {
+                            for (std::size_t l = 0; l != lanes; ++l) {
+                                if (!lane[l].active) {
+                                    blocks[l] = idle.data();
+                                } else if (lane[l].blocks) {
+                                    blocks[l] = lane[l].data;
+                                    lane[l].data += block_octets;
+                                    --lane[l].blocks;
+                                } else {
+                                    blocks[l] = lane[l].tail;
+                                    lane[l].tail += block_octets;
+                                    --lane[l].tail_blocks;
+                                }
+                            }
+
+                            Kernel::compress(state, blocks);
+
+                            for (std::size_t l = 0; l != lanes; ++l) {
+                                if (!lane[l].active || lane[l].blocks || lane[l].tail_blocks) {
+                                    continue;
+                                }
+                                if (lane[l].passes) {
+                                    rehash(lane[l], state + l, lanes);
+                                    continue;
+                                }
+
+                                store(state + l, lanes, digests[lane[l].job]);
+                                if (next != count) {
+                                    start(lane[l], next++, messages, sizes, state + l, lanes);
+                                } else {
+                                    lane[l].active = false;
+                                    --active;
+                                }
+                            }
+                        }
+                    }
+
+                protected:
+                    struct lane_type {
+                        bool active;
+                        std::size_t job;
+                        std::size_t passes;
+
+                        const octet_type *data;
+                        std::size_t blocks;
+
+                        const octet_type *tail;
+                        std::size_t tail_blocks;
+                        std::array<octet_type, 2 * block_octets> tail_buffer;
+                    };
+
+                    static void start(lane_type &lane, std::size_t job, const octet_type *const *messages,
+                                      const std::size_t *sizes, word_type *state, std::size_t stride) {
+                        std::size_t size = sizes[job];
+                        std::size_t remainder = size % block_octets;
+
+                        lane.job = job;
+                        lane.passes = Passes - 1;
+                        lane.data = messages[job];
+                        lane.blocks = size / block_octets;
+
+                        // Merkle-Damgard strengthening: a one bit, zeros, and the 64-bit message length
+                        lane.tail_buffer.fill(0);
+                        if (remainder) {
+                            std::memcpy(lane.tail_buffer.data(), lane.data + lane.blocks * block_octets, remainder);
+                        }
+                        lane.tail_buffer[remainder] = 0x80;
+                        lane.tail_blocks = remainder + 1 + length_octets > block_octets ? 2 : 1;
+
+                        std::uint64_t bits = static_cast<std::uint64_t>(size) * octet_bits;
+                        octet_type *length = lane.tail_buffer.data() + lane.tail_blocks * block_octets;
+                        for (std::size_t i = 1; i <= length_octets; ++i, bits >>= octet_bits) {
+                            *(length - i) = static_cast<octet_type>(bits);
+                        }
+                        lane.tail = lane.tail_buffer.data();
+
+                        typename policy_type::iv_generator iv;
+                        for (std::size_t i = 0; i != state_words; ++i) {
+                            state[i * stride] = iv()[i];
+                        }
+                    }
+
+                    /*!
+                     * @brief Starts the next pass of a lane: its only block is the big endian state words of the
+                     * previous pass, followed by the padding of a message of state_words words.
+                     */
+                    static void rehash(lane_type &lane, word_type *state, std::size_t stride) {
+                        constexpr static const std::size_t message_octets = state_words * word_octets;
+                        BOOST_STATIC_ASSERT(message_octets + 1 + length_octets <= block_octets);
+
+                        octet_type *block = lane.tail_buffer.data();
+                        for (std::size_t i = 0; i != state_words; ++i) {
+                            word_type w = state[i * stride];
+                            for (std::size_t j = 0; j != word_octets; ++j) {
+                                block[i * word_octets + j] = static_cast<octet_type>(w >> (24 - 8 * j));
+                            }
+                        }
+                        std::memset(block + message_octets, 0, block_octets - message_octets);
+                        block[message_octets] = 0x80;
+                        block[block_octets - 2] = static_cast<octet_type>((message_octets * octet_bits) >> 8);
+                        block[block_octets - 1] = static_cast<octet_type>(message_octets * octet_bits);
+
+                        lane.tail = block;
+                        lane.tail_blocks = 1;
+                        --lane.passes;
+
+                        typename policy_type::iv_generator iv;
+                        for (std::size_t i = 0; i != state_words; ++i) {
+                            state[i * stride] = iv()[i];
+                        }
+                    }
+
+                    static void store(const word_type *state, std::size_t stride, digest_type &digest) {
+                        for (std::size_t i = 0; i != digest_words; ++i) {
+                            word_type w = state[i * stride];
+                            digest[4 * i] = static_cast<octet_type>(w >> 24);
+                            digest[4 * i + 1] = static_cast<octet_type>(w >> 16);
+                            digest[4 * i + 2] = static_cast<octet_type>(w >> 8);
+                            digest[4 * i + 3] = static_cast<octet_type>(w);
+                        }
+                    }
+                };
+            }    // namespace detail
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_DETAIL_SHA2_256_MULTI_BUFFER_HPP
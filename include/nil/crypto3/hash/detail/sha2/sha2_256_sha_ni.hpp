@@ -0,0 +1,123 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_DETAIL_SHA2_256_SHA_NI_HPP
+#define CRYPTO3_HASH_DETAIL_SHA2_256_SHA_NI_HPP
+
+#include <cstddef>
+#include <type_traits>
+
+#include <nil/crypto3/detail/cpuid.hpp>
+
+#include <nil/crypto3/hash/detail/sha2/sha2_functions.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+#ifdef CRYPTO3_HAS_SHA_NI
+                /*!
+                 * @brief SHA-224/256 compression with the SHA extensions. sha256rnds2 keeps the state as the
+                 * ABEF and CDGH halves and performs two rounds; sha256msg1/sha256msg2 extend the schedule four
+                 * words at a time.
+                 */
+                struct sha2_256_sha_ni {
+                    typedef sha2_functions<256> functions_type;
+                    typedef functions_type::word_type word_type;
+
+                    constexpr static const std::size_t min_blocks = 1;
+
+                    static bool supported() {
+                        return ::nil::crypto3::detail::cpuid::has_sha() &&
+                               ::nil::crypto3::detail::cpuid::has_sse41();
+                    }
+
+                    /*!
+                     * @brief Compresses n blocks of 16 words each into the state a..h.
+                     */
+                    BOOST_ATTRIBUTE_TARGET("sha,sse4.1")
+                    static void process_blocks(word_type *state, const word_type *blocks, std::size_t n) {
+                        __m128i t = _mm_loadu_si128(reinterpret_cast<const __m128i *>(state));
+                        __m128i s1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(state + 4));
+                        t = _mm_shuffle_epi32(t, 0xB1);            // CDAB
+                        s1 = _mm_shuffle_epi32(s1, 0x1B);          // EFGH
+                        __m128i s0 = _mm_alignr_epi8(t, s1, 8);    // ABEF
+                        s1 = _mm_blend_epi16(s1, t, 0xF0);         // CDGH
+
+                        for (; n; --n, blocks += 16) {
+                            const __m128i abef = s0, cdgh = s1;
+
+                            __m128i m[4];
+                            for (std::size_t i = 0; i != 4; ++i) {
+                                m[i] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(blocks + 4 * i));
+                            }
+
+                            steps(s0, s1, m, std::integral_constant<std::size_t, 0>());
+
+                            s0 = _mm_add_epi32(s0, abef);
+                            s1 = _mm_add_epi32(s1, cdgh);
+                        }
+
+                        t = _mm_shuffle_epi32(s0, 0x1B);     // FEBA
+                        s1 = _mm_shuffle_epi32(s1, 0xB1);    // DCHG
+                        _mm_storeu_si128(reinterpret_cast<__m128i *>(state), _mm_blend_epi16(t, s1, 0xF0));
+                        _mm_storeu_si128(reinterpret_cast<__m128i *>(state + 4), _mm_alignr_epi8(s1, t, 8));
+                    }
+
+                protected:
+                    /*!
+                     * @brief Rounds 4 * I .. 63, four per step, the schedule running three steps ahead. Steps
+                     * are unrolled at compile time.
+                     */
+                    template<std::size_t I>
+                    BOOST_ATTRIBUTE_TARGET("sha,sse4.1")
+                    static inline void steps(__m128i &s0, __m128i &s1, __m128i *m,
+                                             std::integral_constant<std::size_t, I>) {
+                        __m128i &w = m[I % 4], &next = m[(I + 1) % 4], &previous = m[(I + 3) % 4];
+
+                        const __m128i k = _mm_add_epi32(
+                            w, _mm_loadu_si128(
+                                   reinterpret_cast<const __m128i *>(functions_type::round_constants.data() + 4 * I)));
+                        s1 = _mm_sha256rnds2_epu32(s1, s0, k);
+                        if (I >= 3 && I < 15) {
+                            next = _mm_sha256msg2_epu32(_mm_add_epi32(next, _mm_alignr_epi8(w, previous, 4)), w);
+                        }
+                        s0 = _mm_sha256rnds2_epu32(s0, s1, _mm_shuffle_epi32(k, 0x0E));
+                        if (I >= 1 && I < 13) {
+                            previous = _mm_sha256msg1_epu32(previous, w);
+                        }
+
+                        steps(s0, s1, m, std::integral_constant<std::size_t, I + 1>());
+                    }
+
+                    static inline void steps(__m128i &, __m128i &, __m128i *, std::integral_constant<std::size_t, 16>) {
+                    }
+                };
+#endif
+            }    // namespace detail
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_DETAIL_SHA2_256_SHA_NI_HPP
@@ -0,0 +1,135 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_DETAIL_SHA2_512_AVX2_HPP
+#define CRYPTO3_HASH_DETAIL_SHA2_512_AVX2_HPP
+
+#include <cstddef>
+
+#include <nil/crypto3/detail/cpuid.hpp>
+
+#include <nil/crypto3/hash/detail/sha2/sha2_compressor.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+#ifdef CRYPTO3_HAS_X86_INTRINSICS
+                /*!
+                 * @brief SHA-384/512 compression of one message with the message schedule of two consecutive
+                 * blocks expanded in AVX2 registers. Each register holds a pair of consecutive schedule words
+                 * of the first block in its low 128 bits and the same pair of the second block in its high
+                 * 128 bits, so that the unaligned pairs the recurrence reads are in-lane alignr shifts. The
+                 * schedule plus round constants then feeds the scalar rounds of sha2_compressor.
+                 */
+                struct sha2_512_avx2 {
+                    typedef sha2_compressor<512> compressor_type;
+                    typedef compressor_type::functions_type functions_type;
+                    typedef compressor_type::word_type word_type;
+                    typedef compressor_type::state_type state_type;
+
+                    constexpr static const std::size_t block_words = compressor_type::block_words;
+                    constexpr static const std::size_t rounds = compressor_type::rounds;
+                    // A single block gains nothing from the two-block schedule
+                    constexpr static const std::size_t min_blocks = 2;
+
+                    static bool supported() {
+                        return ::nil::crypto3::detail::cpuid::has_avx2();
+                    }
+
+                    /*!
+                     * @brief Compresses n blocks of 16 words each into the state a..h. An odd last block goes
+                     * through the scalar schedule.
+                     */
+                    static void process_blocks(word_type *state, const word_type *blocks, std::size_t n) {
+                        state_type s;
+                        std::copy(state, state + s.size(), s.begin());
+
+                        alignas(32) word_type wk[2][rounds];
+                        for (; n >= 2; n -= 2, blocks += 2 * block_words) {
+                            schedule(blocks, wk);
+                            compressor_type::process_schedule(s, wk[0]);
+                            compressor_type::process_schedule(s, wk[1]);
+                        }
+                        if (n) {
+                            compressor_type::process_blocks(s, blocks, 1);
+                        }
+
+                        std::copy(s.begin(), s.end(), state);
+                    }
+
+                protected:
+                    template<int N>
+                    BOOST_ATTRIBUTE_TARGET("avx2")
+                    static inline __m256i rotr(__m256i x) {
+                        return _mm256_or_si256(_mm256_srli_epi64(x, N), _mm256_slli_epi64(x, 64 - N));
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("avx2")
+                    static inline __m256i sigma_0(__m256i x) {
+                        return _mm256_xor_si256(_mm256_xor_si256(rotr<1>(x), rotr<8>(x)), _mm256_srli_epi64(x, 7));
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("avx2")
+                    static inline __m256i sigma_1(__m256i x) {
+                        return _mm256_xor_si256(_mm256_xor_si256(rotr<19>(x), rotr<61>(x)), _mm256_srli_epi64(x, 6));
+                    }
+
+                    /*!
+                     * @brief Writes schedule word t plus round constant t of block b to wk[b][t], for the two
+                     * blocks starting at blocks.
+                     */
+                    BOOST_ATTRIBUTE_TARGET("avx2")
+                    static void schedule(const word_type *blocks, word_type (*wk)[rounds]) {
+                        // p[j] holds words 2j and 2j + 1 of both blocks
+                        __m256i p[rounds / 2];
+                        for (std::size_t j = 0; j != block_words / 2; ++j) {
+                            p[j] = _mm256_inserti128_si256(
+                                _mm256_castsi128_si256(
+                                    _mm_loadu_si128(reinterpret_cast<const __m128i *>(blocks + 2 * j))),
+                                _mm_loadu_si128(reinterpret_cast<const __m128i *>(blocks + block_words + 2 * j)), 1);
+                        }
+                        // W[t] = sigma_1(W[t - 2]) + W[t - 7] + sigma_0(W[t - 15]) + W[t - 16], for t = 2j, 2j + 1
+                        for (std::size_t j = block_words / 2; j != rounds / 2; ++j) {
+                            p[j] = _mm256_add_epi64(
+                                _mm256_add_epi64(p[j - 8], sigma_0(_mm256_alignr_epi8(p[j - 7], p[j - 8], 8))),
+                                _mm256_add_epi64(_mm256_alignr_epi8(p[j - 3], p[j - 4], 8), sigma_1(p[j - 1])));
+                        }
+
+                        for (std::size_t j = 0; j != rounds / 2; ++j) {
+                            const __m256i k = _mm256_broadcastsi128_si256(_mm_loadu_si128(
+                                reinterpret_cast<const __m128i *>(functions_type::round_constants.data() + 2 * j)));
+                            const __m256i r = _mm256_add_epi64(p[j], k);
+                            _mm_store_si128(reinterpret_cast<__m128i *>(wk[0] + 2 * j), _mm256_castsi256_si128(r));
+                            _mm_store_si128(reinterpret_cast<__m128i *>(wk[1] + 2 * j), _mm256_extracti128_si256(r, 1));
+                        }
+                    }
+                };
+#endif
+            }    // namespace detail
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_DETAIL_SHA2_512_AVX2_HPP
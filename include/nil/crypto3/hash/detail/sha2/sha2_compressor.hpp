@@ -0,0 +1,197 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_DETAIL_SHA2_COMPRESSOR_HPP
+#define CRYPTO3_HASH_DETAIL_SHA2_COMPRESSOR_HPP
+
+#include <array>
+#include <type_traits>
+
+#include <boost/config.hpp>
+#include <boost/static_assert.hpp>
+
+#include <nil/crypto3/hash/detail/sha2/sha2_functions.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                /*!
+                 * @brief SHA-2 compression function (FIPS 180-4, sections 6.2.2 and 6.4.2) written against
+                 * sha2_functions only. Unlike the shacal2 based davies_meyer_compressor, it does not expand the
+                 * whole key schedule up front: each round extends a rolling window of the last 16 schedule
+                 * words in place, and the rounds are unrolled with the working variables renamed instead of
+                 * shifted. It is also usable in constant expressions.
+                 * @tparam CipherVersion 256 for SHA-224/256, 512 for SHA-384/512
+                 */
+                template<std::size_t CipherVersion>
+                struct sha2_compressor {
+                    typedef sha2_functions<CipherVersion> functions_type;
+
+                    constexpr static const std::size_t word_bits = functions_type::word_bits;
+                    typedef typename functions_type::word_type word_type;
+
+                    constexpr static const std::size_t state_words = 8;
+                    constexpr static const std::size_t state_bits = state_words * word_bits;
+                    typedef std::array<word_type, state_words> state_type;
+
+                    constexpr static const std::size_t block_words = 16;
+                    constexpr static const std::size_t block_bits = block_words * word_bits;
+                    typedef std::array<word_type, block_words> block_type;
+
+                    constexpr static const std::size_t rounds = functions_type::rounds;
+                    BOOST_STATIC_ASSERT(rounds % state_words == 0);
+
+                    constexpr static inline void process_block(state_type &state, const block_type &block) {
+                        block_type W = block;
+
+                        word_type a = state[0], b = state[1], c = state[2], d = state[3], e = state[4], f = state[5],
+                                  g = state[6], h = state[7];
+
+                        steps(a, b, c, d, e, f, g, h, W, std::integral_constant<std::size_t, 0>());
+
+                        add(state, a, b, c, d, e, f, g, h);
+                    }
+
+                    /*!
+                     * @brief Runs the rounds on a message schedule computed elsewhere, e.g. by a SIMD kernel:
+                     * wk[t] is schedule word t plus round constant t.
+                     */
+                    constexpr static inline void process_schedule(state_type &state, const word_type *wk) {
+                        word_type a = state[0], b = state[1], c = state[2], d = state[3], e = state[4], f = state[5],
+                                  g = state[6], h = state[7];
+
+                        steps(a, b, c, d, e, f, g, h, wk, std::integral_constant<std::size_t, 0>());
+
+                        add(state, a, b, c, d, e, f, g, h);
+                    }
+
+                    /*!
+                     * @brief Processes n consecutive blocks of block_words words each.
+                     */
+                    constexpr static inline void process_blocks(state_type &state, const word_type *blocks,
+                                                                std::size_t n) {
+                        block_type block = {};
+                        for (; n; --n, blocks += block_words) {
+                            for (std::size_t t = 0; t != block_words; ++t) {
+                                block[t] = blocks[t];
+                            }
+                            process_block(state, block);
+                        }
+                    }
+
+                protected:
+                    constexpr static inline void add(state_type &state, word_type a, word_type b, word_type c,
+                                                     word_type d, word_type e, word_type f, word_type g,
+                                                     word_type h) {
+                        state[0] += a;
+                        state[1] += b;
+                        state[2] += c;
+                        state[3] += d;
+                        state[4] += e;
+                        state[5] += f;
+                        state[6] += g;
+                        state[7] += h;
+                    }
+
+                    /*!
+                     * @brief Rounds T .. rounds - 1, unrolled at compile time eight at a time, after which the
+                     * variables are back in place.
+                     */
+                    template<std::size_t T>
+                    BOOST_FORCEINLINE constexpr static void steps(word_type &a, word_type &b, word_type &c,
+                                                                  word_type &d, word_type &e, word_type &f,
+                                                                  word_type &g, word_type &h, block_type &W,
+                                                                  std::integral_constant<std::size_t, T>) {
+                        round(a, b, c, d, e, f, g, h, schedule<T>(W) + functions_type::round_constants[T]);
+                        round(h, a, b, c, d, e, f, g, schedule<T + 1>(W) + functions_type::round_constants[T + 1]);
+                        round(g, h, a, b, c, d, e, f, schedule<T + 2>(W) + functions_type::round_constants[T + 2]);
+                        round(f, g, h, a, b, c, d, e, schedule<T + 3>(W) + functions_type::round_constants[T + 3]);
+                        round(e, f, g, h, a, b, c, d, schedule<T + 4>(W) + functions_type::round_constants[T + 4]);
+                        round(d, e, f, g, h, a, b, c, schedule<T + 5>(W) + functions_type::round_constants[T + 5]);
+                        round(c, d, e, f, g, h, a, b, schedule<T + 6>(W) + functions_type::round_constants[T + 6]);
+                        round(b, c, d, e, f, g, h, a, schedule<T + 7>(W) + functions_type::round_constants[T + 7]);
+
+                        steps(a, b, c, d, e, f, g, h, W, std::integral_constant<std::size_t, T + 8>());
+                    }
+
+                    template<std::size_t T>
+                    BOOST_FORCEINLINE constexpr static void steps(word_type &a, word_type &b, word_type &c,
+                                                                  word_type &d, word_type &e, word_type &f,
+                                                                  word_type &g, word_type &h, const word_type *wk,
+                                                                  std::integral_constant<std::size_t, T>) {
+                        round(a, b, c, d, e, f, g, h, wk[T]);
+                        round(h, a, b, c, d, e, f, g, wk[T + 1]);
+                        round(g, h, a, b, c, d, e, f, wk[T + 2]);
+                        round(f, g, h, a, b, c, d, e, wk[T + 3]);
+                        round(e, f, g, h, a, b, c, d, wk[T + 4]);
+                        round(d, e, f, g, h, a, b, c, wk[T + 5]);
+                        round(c, d, e, f, g, h, a, b, wk[T + 6]);
+                        round(b, c, d, e, f, g, h, a, wk[T + 7]);
+
+                        steps(a, b, c, d, e, f, g, h, wk, std::integral_constant<std::size_t, T + 8>());
+                    }
+
+                    constexpr static inline void steps(word_type &, word_type &, word_type &, word_type &,
+                                                       word_type &, word_type &, word_type &, word_type &,
+                                                       block_type &, std::integral_constant<std::size_t, rounds>) {
+                    }
+
+                    constexpr static inline void steps(word_type &, word_type &, word_type &, word_type &,
+                                                       word_type &, word_type &, word_type &, word_type &,
+                                                       const word_type *, std::integral_constant<std::size_t, rounds>) {
+                    }
+
+                    /*!
+                     * @brief Schedule word T. From word 16 on, it replaces word T - 16 in the window W.
+                     */
+                    template<std::size_t T>
+                    BOOST_FORCEINLINE constexpr static word_type schedule(block_type &W) {
+                        if (T >= block_words) {
+                            W[T % block_words] += functions_type::sigma_1(W[(T - 2) % block_words]) +
+                                                  W[(T - 7) % block_words] +
+                                                  functions_type::sigma_0(W[(T - 15) % block_words]);
+                        }
+                        return W[T % block_words];
+                    }
+
+                    /*!
+                     * @brief Round on schedule word plus round constant wk. The caller rotates the arguments
+                     * instead of the round shifting the variables: d becomes the new e and h the new a.
+                     */
+                    BOOST_FORCEINLINE constexpr static void round(word_type a, word_type b, word_type c,
+                                                                  word_type &d, word_type e, word_type f,
+                                                                  word_type g, word_type &h, word_type wk) {
+                        const word_type T1 = h + functions_type::Sigma_1(e) + functions_type::ch(e, f, g) + wk;
+                        d += T1;
+                        h = T1 + functions_type::Sigma_0(a) + functions_type::maj(a, b, c);
+                    }
+                };
+            }    // namespace detail
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_DETAIL_SHA2_COMPRESSOR_HPP
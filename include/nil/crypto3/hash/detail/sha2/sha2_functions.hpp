@@ -0,0 +1,152 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_DETAIL_SHA2_FUNCTIONS_HPP
+#define CRYPTO3_HASH_DETAIL_SHA2_FUNCTIONS_HPP
+
+#include <array>
+
+#include <nil/crypto3/detail/basic_functions.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                /*!
+                 * @brief SHA-2 round constants and boolean functions (FIPS 180-4, sections 4.1.2, 4.1.3 and 4.2),
+                 * used by the SHA-2 specific kernels which do not go through the shacal2 block cipher.
+                 * @tparam CipherVersion 256 for SHA-224/256, 512 for SHA-384/512 and SHA-512/t
+                 */
+                template<std::size_t CipherVersion>
+                struct sha2_functions;
+
+                template<>
+                struct sha2_functions<256> : public ::nil::crypto3::detail::basic_functions<32> {
+                    constexpr static const std::size_t rounds = 64;
+                    typedef std::array<word_type, rounds> round_constants_type;
+
+                    constexpr static const round_constants_type round_constants = {
+                        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+                        0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+                        0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+                        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+                        0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+                        0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+                        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+                        0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+                    constexpr static inline word_type ch(word_type x, word_type y, word_type z) {
+                        return (x & y) ^ (~x & z);
+                    }
+
+                    constexpr static inline word_type maj(word_type x, word_type y, word_type z) {
+                        return (x & y) | (z & (x | y));
+                    }
+
+                    constexpr static inline word_type Sigma_0(word_type x) {
+                        return rotr<2>(x) ^ rotr<13>(x) ^ rotr<22>(x);
+                    }
+
+                    constexpr static inline word_type Sigma_1(word_type x) {
+                        return rotr<6>(x) ^ rotr<11>(x) ^ rotr<25>(x);
+                    }
+
+                    constexpr static inline word_type sigma_0(word_type x) {
+                        return rotr<7>(x) ^ rotr<18>(x) ^ shr<3>(x);
+                    }
+
+                    constexpr static inline word_type sigma_1(word_type x) {
+                        return rotr<17>(x) ^ rotr<19>(x) ^ shr<10>(x);
+                    }
+                };
+
+                template<>
+                struct sha2_functions<512> : public ::nil::crypto3::detail::basic_functions<64> {
+                    constexpr static const std::size_t rounds = 80;
+                    typedef std::array<word_type, rounds> round_constants_type;
+
+                    constexpr static const round_constants_type round_constants = {
+                        UINT64_C(0x428a2f98d728ae22), UINT64_C(0x7137449123ef65cd), UINT64_C(0xb5c0fbcfec4d3b2f),
+                        UINT64_C(0xe9b5dba58189dbbc), UINT64_C(0x3956c25bf348b538), UINT64_C(0x59f111f1b605d019),
+                        UINT64_C(0x923f82a4af194f9b), UINT64_C(0xab1c5ed5da6d8118), UINT64_C(0xd807aa98a3030242),
+                        UINT64_C(0x12835b0145706fbe), UINT64_C(0x243185be4ee4b28c), UINT64_C(0x550c7dc3d5ffb4e2),
+                        UINT64_C(0x72be5d74f27b896f), UINT64_C(0x80deb1fe3b1696b1), UINT64_C(0x9bdc06a725c71235),
+                        UINT64_C(0xc19bf174cf692694), UINT64_C(0xe49b69c19ef14ad2), UINT64_C(0xefbe4786384f25e3),
+                        UINT64_C(0x0fc19dc68b8cd5b5), UINT64_C(0x240ca1cc77ac9c65), UINT64_C(0x2de92c6f592b0275),
+                        UINT64_C(0x4a7484aa6ea6e483), UINT64_C(0x5cb0a9dcbd41fbd4), UINT64_C(0x76f988da831153b5),
+                        UINT64_C(0x983e5152ee66dfab), UINT64_C(0xa831c66d2db43210), UINT64_C(0xb00327c898fb213f),
+                        UINT64_C(0xbf597fc7beef0ee4), UINT64_C(0xc6e00bf33da88fc2), UINT64_C(0xd5a79147930aa725),
+                        UINT64_C(0x06ca6351e003826f), UINT64_C(0x142929670a0e6e70), UINT64_C(0x27b70a8546d22ffc),
+                        UINT64_C(0x2e1b21385c26c926), UINT64_C(0x4d2c6dfc5ac42aed), UINT64_C(0x53380d139d95b3df),
+                        UINT64_C(0x650a73548baf63de), UINT64_C(0x766a0abb3c77b2a8), UINT64_C(0x81c2c92e47edaee6),
+                        UINT64_C(0x92722c851482353b), UINT64_C(0xa2bfe8a14cf10364), UINT64_C(0xa81a664bbc423001),
+                        UINT64_C(0xc24b8b70d0f89791), UINT64_C(0xc76c51a30654be30), UINT64_C(0xd192e819d6ef5218),
+                        UINT64_C(0xd69906245565a910), UINT64_C(0xf40e35855771202a), UINT64_C(0x106aa07032bbd1b8),
+                        UINT64_C(0x19a4c116b8d2d0c8), UINT64_C(0x1e376c085141ab53), UINT64_C(0x2748774cdf8eeb99),
+                        UINT64_C(0x34b0bcb5e19b48a8), UINT64_C(0x391c0cb3c5c95a63), UINT64_C(0x4ed8aa4ae3418acb),
+                        UINT64_C(0x5b9cca4f7763e373), UINT64_C(0x682e6ff3d6b2b8a3), UINT64_C(0x748f82ee5defb2fc),
+                        UINT64_C(0x78a5636f43172f60), UINT64_C(0x84c87814a1f0ab72), UINT64_C(0x8cc702081a6439ec),
+                        UINT64_C(0x90befffa23631e28), UINT64_C(0xa4506cebde82bde9), UINT64_C(0xbef9a3f7b2c67915),
+                        UINT64_C(0xc67178f2e372532b), UINT64_C(0xca273eceea26619c), UINT64_C(0xd186b8c721c0c207),
+                        UINT64_C(0xeada7dd6cde0eb1e), UINT64_C(0xf57d4f7fee6ed178), UINT64_C(0x06f067aa72176fba),
+                        UINT64_C(0x0a637dc5a2c898a6), UINT64_C(0x113f9804bef90dae), UINT64_C(0x1b710b35131c471b),
+                        UINT64_C(0x28db77f523047d84), UINT64_C(0x32caab7b40c72493), UINT64_C(0x3c9ebe0a15c9bebc),
+                        UINT64_C(0x431d67c49c100d4c), UINT64_C(0x4cc5d4becb3e42b6), UINT64_C(0x597f299cfc657e2a),
+                        UINT64_C(0x5fcb6fab3ad6faec), UINT64_C(0x6c44198c4a475817)};
+
+                    constexpr static inline word_type ch(word_type x, word_type y, word_type z) {
+                        return (x & y) ^ (~x & z);
+                    }
+
+                    constexpr static inline word_type maj(word_type x, word_type y, word_type z) {
+                        return (x & y) | (z & (x | y));
+                    }
+
+                    constexpr static inline word_type Sigma_0(word_type x) {
+                        return rotr<28>(x) ^ rotr<34>(x) ^ rotr<39>(x);
+                    }
+
+                    constexpr static inline word_type Sigma_1(word_type x) {
+                        return rotr<14>(x) ^ rotr<18>(x) ^ rotr<41>(x);
+                    }
+
+                    constexpr static inline word_type sigma_0(word_type x) {
+                        return rotr<1>(x) ^ rotr<8>(x) ^ shr<7>(x);
+                    }
+
+                    constexpr static inline word_type sigma_1(word_type x) {
+                        return rotr<19>(x) ^ rotr<61>(x) ^ shr<6>(x);
+                    }
+                };
+
+                constexpr typename sha2_functions<256>::round_constants_type const sha2_functions<256>::round_constants;
+
+                constexpr typename sha2_functions<512>::round_constants_type const sha2_functions<512>::round_constants;
+            }    // namespace detail
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_DETAIL_SHA2_FUNCTIONS_HPP
@@ -30,8 +30,12 @@
 
 #include <nil/crypto3/detail/static_digest.hpp>
 
+#include <nil/crypto3/hash/detail/sha2/sha2_compressor.hpp>
+
 #include <array>
 
+#include <boost/static_assert.hpp>
+
 namespace nil {
     namespace crypto3 {
         namespace hashes {
@@ -59,7 +63,11 @@ namespace nil {
                     typedef typename stream_endian::big_octet_big_bit digest_endian;
                 };
 
-                template<std::size_t Version>
+                /*!
+                 * @brief SHA-2 parameters for a Version bits digest. CipherVersion defaults to the standard
+                 * compression of that digest size; sha2_policy<t, 512> with t other than 384 and 512 is SHA-512/t.
+                 */
+                template<std::size_t Version, std::size_t CipherVersion = (Version > 256 ? 512 : 256)>
                 struct sha2_policy;
 
                 template<>
@@ -76,11 +84,13 @@ namespace nil {
 
                     typedef static_digest<digest_bits> digest_type;
 
+                    constexpr static const state_type initial_state =
+                        {{0xc1059ed8, 0x367cd507, 0x3070dd17, 0xf70e5939, 0xffc00b31, 0x68581511, 0x64f98fa7,
+                          0xbefa4fa4}};
+
                     struct iv_generator {
-                        state_type const &operator()() const {
-                            static state_type const H0 = {{0xc1059ed8, 0x367cd507, 0x3070dd17, 0xf70e5939, 0xffc00b31,
-                                                           0x68581511, 0x64f98fa7, 0xbefa4fa4}};
-                            return H0;
+                        constexpr state_type const &operator()() const {
+                            return initial_state;
                         }
                     };
                 };
@@ -101,11 +111,13 @@ namespace nil {
                                                                    0x86, 0x48, 0x01, 0x65, 0x03, 0x04, 0x02,
                                                                    0x04, 0x05, 0x00, 0x04, 0x20};
 
+                    constexpr static const state_type initial_state =
+                        {{0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab,
+                          0x5be0cd19}};
+
                     struct iv_generator {
-                        state_type const &operator()() const {
-                            static state_type const H0 = {{0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f,
-                                                           0x9b05688c, 0x1f83d9ab, 0x5be0cd19}};
-                            return H0;
+                        constexpr state_type const &operator()() const {
+                            return initial_state;
                         }
                     };
                 };
@@ -124,13 +136,14 @@ namespace nil {
 
                     typedef static_digest<digest_bits> digest_type;
 
+                    constexpr static const state_type initial_state =
+                        {{UINT64_C(0xcbbb9d5dc1059ed8), UINT64_C(0x629a292a367cd507), UINT64_C(0x9159015a3070dd17),
+                          UINT64_C(0x152fecd8f70e5939), UINT64_C(0x67332667ffc00b31), UINT64_C(0x8eb44a8768581511),
+                          UINT64_C(0xdb0c2e0d64f98fa7), UINT64_C(0x47b5481dbefa4fa4)}};
+
                     struct iv_generator {
-                        state_type const &operator()() const {
-                            static state_type const H0 = {{UINT64_C(0xcbbb9d5dc1059ed8), UINT64_C(0x629a292a367cd507),
-                                                           UINT64_C(0x9159015a3070dd17), UINT64_C(0x152fecd8f70e5939),
-                                                           UINT64_C(0x67332667ffc00b31), UINT64_C(0x8eb44a8768581511),
-                                                           UINT64_C(0xdb0c2e0d64f98fa7), UINT64_C(0x47b5481dbefa4fa4)}};
-                            return H0;
+                        constexpr state_type const &operator()() const {
+                            return initial_state;
                         }
                     };
                 };
@@ -150,13 +163,86 @@ namespace nil {
                                                                    0x86, 0x48, 0x01, 0x65, 0x03, 0x04, 0x02,
                                                                    0x04, 0x05, 0x00, 0x04, 0x40};
 
+                    constexpr static const state_type initial_state =
+                        {{UINT64_C(0x6a09e667f3bcc908), UINT64_C(0xbb67ae8584caa73b), UINT64_C(0x3c6ef372fe94f82b),
+                          UINT64_C(0xa54ff53a5f1d36f1), UINT64_C(0x510e527fade682d1), UINT64_C(0x9b05688c2b3e6c1f),
+                          UINT64_C(0x1f83d9abfb41bd6b), UINT64_C(0x5be0cd19137e2179)}};
+
                     struct iv_generator {
-                        state_type const &operator()() const {
-                            static state_type const H0 = {{UINT64_C(0x6a09e667f3bcc908), UINT64_C(0xbb67ae8584caa73b),
-                                                           UINT64_C(0x3c6ef372fe94f82b), UINT64_C(0xa54ff53a5f1d36f1),
-                                                           UINT64_C(0x510e527fade682d1), UINT64_C(0x9b05688c2b3e6c1f),
-                                                           UINT64_C(0x1f83d9abfb41bd6b), UINT64_C(0x5be0cd19137e2179)}};
-                            return H0;
+                        constexpr state_type const &operator()() const {
+                            return initial_state;
+                        }
+                    };
+                };
+
+                /*!
+                 * @brief SHA-512/t initial state (FIPS 180-4, section 5.3.6.1): the SHA-512 initial state with
+                 * every word xored with a5a5a5a5a5a5a5a5 is used to hash the name "SHA-512/t", t in decimal.
+                 * @tparam DigestBits t
+                 */
+                template<std::size_t DigestBits>
+                constexpr typename basic_sha2_policy<512>::state_type sha2_512_t_initial_state() {
+                    typedef sha2_compressor<512> compressor_type;
+                    const std::size_t word_octets = compressor_type::word_bits / CHAR_BIT;
+
+                    compressor_type::state_type state = {};
+                    for (std::size_t i = 0; i != compressor_type::state_words; ++i) {
+                        state[i] = sha2_policy<512>::initial_state[i] ^ UINT64_C(0xa5a5a5a5a5a5a5a5);
+                    }
+
+                    std::array<std::uint8_t, compressor_type::block_bits / CHAR_BIT> name = {};
+                    std::size_t n = 0;
+                    for (const char *prefix = "SHA-512/"; *prefix; ++prefix) {
+                        name[n++] = static_cast<std::uint8_t>(*prefix);
+                    }
+                    std::size_t digits = 0;
+                    for (std::size_t t = DigestBits; t; t /= 10) {
+                        ++digits;
+                    }
+                    for (std::size_t t = DigestBits, i = n + digits; t; t /= 10) {
+                        name[--i] = static_cast<std::uint8_t>('0' + t % 10);
+                    }
+                    n += digits;
+
+                    // A single block: 0x80, zeros and the big endian length in bits
+                    name[n] = 0x80;
+                    name[name.size() - 1] = static_cast<std::uint8_t>(n * CHAR_BIT);
+                    name[name.size() - 2] = static_cast<std::uint8_t>((n * CHAR_BIT) >> CHAR_BIT);
+
+                    compressor_type::block_type block = {};
+                    for (std::size_t i = 0; i != name.size(); ++i) {
+                        block[i / word_octets] = (block[i / word_octets] << CHAR_BIT) | name[i];
+                    }
+                    compressor_type::process_block(state, block);
+
+                    return state;
+                }
+
+                /*!
+                 * @brief SHA-512/t: the SHA-512 compression with the initial state generated from t and the
+                 * digest truncated to t bits. On 64-bit hosts it is faster than SHA-224/256 for large inputs.
+                 * @tparam DigestBits t
+                 */
+                template<std::size_t DigestBits>
+                struct sha2_policy<DigestBits, 512> : public basic_sha2_policy<512> {
+                    BOOST_STATIC_ASSERT(DigestBits && DigestBits < 512 && DigestBits != 384);
+                    BOOST_STATIC_ASSERT(DigestBits % CHAR_BIT == 0);
+
+                    constexpr static const std::size_t digest_bits = DigestBits;
+
+                    constexpr static const std::size_t pkcs_id_size = 0;
+                    constexpr static const std::size_t pkcs_id_bits = pkcs_id_size * CHAR_BIT;
+                    typedef std::array<std::uint8_t, pkcs_id_size> pkcs_id_type;
+
+                    constexpr static const pkcs_id_type pkcs_id = {};
+
+                    typedef static_digest<digest_bits> digest_type;
+
+                    constexpr static const state_type initial_state = sha2_512_t_initial_state<DigestBits>();
+
+                    struct iv_generator {
+                        constexpr state_type const &operator()() const {
+                            return initial_state;
                         }
                     };
                 };
@@ -169,6 +255,22 @@ namespace nil {
 
                 constexpr typename sha2_policy<512>::pkcs_id_type const sha2_policy<512>::pkcs_id;
 
+                constexpr typename sha2_policy<224>::state_type const sha2_policy<224>::initial_state;
+
+                constexpr typename sha2_policy<256>::state_type const sha2_policy<256>::initial_state;
+
+                constexpr typename sha2_policy<384>::state_type const sha2_policy<384>::initial_state;
+
+                constexpr typename sha2_policy<512>::state_type const sha2_policy<512>::initial_state;
+
+                template<std::size_t DigestBits>
+                constexpr typename sha2_policy<DigestBits, 512>::pkcs_id_type const
+                    sha2_policy<DigestBits, 512>::pkcs_id;
+
+                template<std::size_t DigestBits>
+                constexpr typename sha2_policy<DigestBits, 512>::state_type const
+                    sha2_policy<DigestBits, 512>::initial_state;
+
             }    // namespace detail
         }        // namespace hashes
     }            // namespace crypto3
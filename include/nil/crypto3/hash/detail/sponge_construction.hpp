@@ -30,6 +30,7 @@
 #include <nil/crypto3/detail/pack.hpp>
 
 #include <nil/crypto3/hash/detail/nop_finalizer.hpp>
+#include <nil/crypto3/hash/detail/instrument.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -80,10 +81,26 @@ namespace nil {
 
                 template<typename Integer = std::size_t>
                 inline sponge_construction &process_block(const block_type &block, Integer seen = Integer()) {
+                    CRYPTO3_HASH_INSTRUMENT_ADD(sponge_construction, blocks_compressed, 1);
+                    CRYPTO3_HASH_INSTRUMENT_TIME(sponge_construction, compression_ns);
                     compressor_functor::process_block(state_, block);
                     return *this;
                 }
 
+                /*!
+                 * @brief Processes n consecutive blocks of block_words words each in a single compressor call.
+                 * The bit count argument is ignored, it keeps the signature in line with
+                 * haifa_construction::process_blocks.
+                 */
+                template<typename Integer = std::size_t>
+                inline sponge_construction &process_blocks(const word_type *blocks, std::size_t n,
+                                                           Integer = Integer()) {
+                    CRYPTO3_HASH_INSTRUMENT_ADD(sponge_construction, blocks_compressed, n);
+                    CRYPTO3_HASH_INSTRUMENT_TIME(sponge_construction, compression_ns);
+                    compressor_functor::process_blocks(state_, blocks, n);
+                    return *this;
+                }
+
                 inline digest_type digest(const block_type &block = block_type(),
                                           std::size_t total_seen = std::size_t()) {
                     using namespace nil::crypto3::detail;
@@ -99,16 +116,21 @@ namespace nil {
                     padding_functor padding;
                     padding(b, block_seen);
                     process_block(b);
+                    if (!copy_seen) {
+                        CRYPTO3_HASH_INSTRUMENT_ADD(sponge_construction, padding_blocks, 1);
+                    }
 
                     // Process additional block if not all bits were padded
                     if (!padding.is_last_block()) {
                         std::fill(b.begin(), b.end(), 0);
                         padding.process_last(b, copy_seen);
                         process_block(b);
+                        CRYPTO3_HASH_INSTRUMENT_ADD(sponge_construction, padding_blocks, 1);
                     }
 
                     // Apply finalizer
                     finalizer_functor()(state_);
+                    CRYPTO3_HASH_INSTRUMENT_ADD(sponge_construction, finalizations, 1);
 
                     // Convert digest to byte representation
                     std::array<octet_type, state_bits / octet_bits> d_full;
@@ -133,6 +155,13 @@ namespace nil {
                     reset(iv());
                 }
 
+                /*!
+                 * @brief Sets the chaining state verbatim to a value previously obtained from state().
+                 */
+                void restore(const state_type &s) {
+                    state_ = s;
+                }
+
                 state_type const &state() const {
                     return state_;
                 }
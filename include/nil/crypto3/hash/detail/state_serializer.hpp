@@ -0,0 +1,198 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_STATE_SERIALIZER_HPP
+#define CRYPTO3_HASH_STATE_SERIALIZER_HPP
+
+#include <cstdint>
+#include <cstddef>
+
+#include <boost/static_assert.hpp>
+
+#include <nil/crypto3/detail/octet.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                /*!
+                 * @brief Portable binary format of a mid-stream hash state: the construction chaining state,
+                 * the pending block and the number of bits seen so far.
+                 *
+                 * Layout, all integers little-endian regardless of the host:
+                 * - magic "C3HS" and format version (1 octet);
+                 * - word_bits, state_words, block_words and digest_bits (2 octets each), checked on load;
+                 * - fingerprint of the hash (8 octets), checked on load;
+                 * - total_seen (8 octets);
+                 * - state_words state words and block_words cache words, word_bits / 8 octets each.
+                 *
+                 * The fingerprint is the first 8 octets of the digest of the empty message. It depends on the
+                 * initial state or parameter block, the padding, the finalizer and the compression function, so
+                 * it tells apart hashes of the same shape, e.g. sha2<512> and blake2b<512>, keccak_1600<256> and
+                 * sha3<256> or sha2<256> and sha256d.
+                 *
+                 * @tparam Construction
+                 */
+                template<typename Construction>
+                struct state_serializer {
+                    typedef Construction construction_type;
+
+                    constexpr static const std::size_t word_bits = construction_type::word_bits;
+                    typedef typename construction_type::word_type word_type;
+
+                    constexpr static const std::size_t state_words = construction_type::state_words;
+                    typedef typename construction_type::state_type state_type;
+
+                    constexpr static const std::size_t block_words = construction_type::block_words;
+                    typedef typename construction_type::block_type block_type;
+
+                    constexpr static const std::size_t digest_bits = construction_type::digest_bits;
+                    typedef typename construction_type::digest_type digest_type;
+
+                    BOOST_STATIC_ASSERT(word_bits % octet_bits == 0);
+                    constexpr static const std::size_t word_octets = word_bits / octet_bits;
+
+                    constexpr static const octet_type version = 2;
+                    constexpr static const std::size_t fingerprint_octets = 8;
+                    constexpr static const std::size_t header_octets = 4 + 1 + 4 * 2 + fingerprint_octets;
+                    constexpr static const std::size_t serialized_octets =
+                        header_octets + 8 + (state_words + block_words) * word_octets;
+
+                    template<typename OutputIterator>
+                    static OutputIterator save(const state_type &state, const block_type &cache,
+                                               std::uint64_t total_seen, OutputIterator out) {
+                        *out++ = 'C';
+                        *out++ = '3';
+                        *out++ = 'H';
+                        *out++ = 'S';
+                        *out++ = version;
+                        out = write(word_bits, 2, out);
+                        out = write(state_words, 2, out);
+                        out = write(block_words, 2, out);
+                        out = write(digest_bits, 2, out);
+                        out = write(fingerprint(), fingerprint_octets, out);
+                        out = write(total_seen, 8, out);
+                        for (std::size_t i = 0; i != state_words; ++i) {
+                            out = write(state[i], word_octets, out);
+                        }
+                        for (std::size_t i = 0; i != block_words; ++i) {
+                            out = write(cache[i], word_octets, out);
+                        }
+                        return out;
+                    }
+
+                    /*!
+                     * @brief Parses a state written by save.
+                     * @return false if the input is truncated, has a different format version or was written
+                     * for another hash. The output arguments are left untouched then.
+                     */
+                    template<typename InputIterator>
+                    static bool load(InputIterator first, InputIterator last, state_type &state, block_type &cache,
+                                     std::uint64_t &total_seen) {
+                        const octet_type magic[] = {'C', '3', 'H', 'S', version};
+                        for (octet_type m : magic) {
+                            if (first == last || static_cast<octet_type>(*first++) != m) {
+                                return false;
+                            }
+                        }
+
+                        const std::size_t shape[] = {word_bits, state_words, block_words, digest_bits};
+                        for (std::size_t s : shape) {
+                            std::size_t v;
+                            if (!read(first, last, 2, v) || v != s) {
+                                return false;
+                            }
+                        }
+
+                        std::uint64_t id;
+                        if (!read(first, last, fingerprint_octets, id) || id != fingerprint()) {
+                            return false;
+                        }
+
+                        std::uint64_t seen;
+                        state_type s;
+                        block_type c;
+                        if (!read(first, last, 8, seen)) {
+                            return false;
+                        }
+                        for (std::size_t i = 0; i != state_words; ++i) {
+                            if (!read(first, last, word_octets, s[i])) {
+                                return false;
+                            }
+                        }
+                        for (std::size_t i = 0; i != block_words; ++i) {
+                            if (!read(first, last, word_octets, c[i])) {
+                                return false;
+                            }
+                        }
+
+                        state = s;
+                        cache = c;
+                        total_seen = seen;
+                        return true;
+                    }
+
+                    static std::uint64_t fingerprint() {
+                        static const std::uint64_t value = make_fingerprint();
+                        return value;
+                    }
+
+                protected:
+                    static std::uint64_t make_fingerprint() {
+                        BOOST_STATIC_ASSERT(digest_bits >= fingerprint_octets * octet_bits);
+
+                        const digest_type d = construction_type().digest();
+                        std::uint64_t value = 0;
+                        for (std::size_t i = 0; i != fingerprint_octets; ++i) {
+                            value |= static_cast<std::uint64_t>(d[i]) << (i * octet_bits);
+                        }
+                        return value;
+                    }
+
+                    template<typename Integer, typename OutputIterator>
+                    static OutputIterator write(Integer value, std::size_t octets, OutputIterator out) {
+                        for (std::size_t i = 0; i != octets; ++i) {
+                            *out++ = static_cast<octet_type>(value >> (i * octet_bits));
+                        }
+                        return out;
+                    }
+
+                    template<typename InputIterator, typename Integer>
+                    static bool read(InputIterator &first, InputIterator last, std::size_t octets, Integer &value) {
+                        value = Integer();
+                        for (std::size_t i = 0; i != octets; ++i) {
+                            if (first == last) {
+                                return false;
+                            }
+                            value |= static_cast<Integer>(static_cast<octet_type>(*first++)) << (i * octet_bits);
+                        }
+                        return true;
+                    }
+                };
+            }    // namespace detail
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_STATE_SERIALIZER_HPP
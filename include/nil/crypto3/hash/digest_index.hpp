@@ -0,0 +1,239 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_DIGEST_INDEX_HPP
+#define CRYPTO3_HASH_DIGEST_INDEX_HPP
+
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <boost/static_assert.hpp>
+
+#include <nil/crypto3/hash/detail/digest_table.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            /*!
+             * @brief Set of digests for deduplication, e.g. of content addressed chunks.
+             *
+             * Digests are stored inline in a flat open addressing table, probed 16 slots at a time, and
+             * their own leading bits serve as hash since they already are uniformly distributed. Memory is
+             * one cache line aligned region; open() puts it in a file, so that the set survives restarts.
+             * Growing the table throws std::bad_alloc, or std::system_error for a file backed set.
+             *
+             * @tparam DigestBits
+             */
+            template<std::size_t DigestBits>
+            class digest_set {
+                typedef detail::digest_table<DigestBits, void> table_type;
+
+            public:
+                typedef static_digest<DigestBits> digest_type;
+
+                digest_set() {
+                }
+
+                explicit digest_set(std::size_t n) {
+                    reserve(n);
+                }
+
+                /*!
+                 * @return true if d was not in the set
+                 */
+                bool insert(const digest_type &d) {
+                    return table.insert(d).second;
+                }
+
+                bool contains(const digest_type &d) const {
+                    return table.find(d);
+                }
+
+                /*!
+                 * @return true if d was in the set
+                 */
+                bool erase(const digest_type &d) {
+                    return table.erase(d);
+                }
+
+                std::size_t size() const {
+                    return table.size();
+                }
+
+                bool empty() const {
+                    return !size();
+                }
+
+                std::size_t capacity() const {
+                    return table.capacity();
+                }
+
+                /*!
+                 * @brief Makes room for n digests, so that inserting them does not grow the table.
+                 */
+                void reserve(std::size_t n) {
+                    table.reserve(n);
+                }
+
+                void clear() {
+                    table.clear();
+                }
+
+                /*!
+                 * @brief Calls f(digest) for every digest, in no particular order.
+                 */
+                template<typename F>
+                void for_each(F f) const {
+                    table.for_each([&f](const typename table_type::slot_type &s) { f(s.key); });
+                }
+
+#ifdef BOOST_HAS_UNISTD_H
+                /*!
+                 * @brief Switches to the set stored in the file at path, or to a new empty one with room for n
+                 * digests if the file is missing or empty. The current digests are dropped.
+                 * @return false if the file could not be created or mapped, or holds something else
+                 */
+                bool open(const std::string &path, std::size_t n = 0) {
+                    return table.open(path, n);
+                }
+
+                /*!
+                 * @brief Writes the changes of a file backed set to its file.
+                 */
+                bool sync() const {
+                    return table.sync();
+                }
+#endif
+
+            private:
+                table_type table;
+            };
+
+            /*!
+             * @brief Map from digests to trivially copyable values, e.g. chunk locations of a content addressed
+             * store, laid out as digest_set with each value stored next to its digest.
+             *
+             * @tparam DigestBits
+             * @tparam Mapped
+             */
+            template<std::size_t DigestBits, typename Mapped>
+            class digest_map {
+                BOOST_STATIC_ASSERT(std::is_trivially_copyable<Mapped>::value);
+
+                typedef detail::digest_table<DigestBits, Mapped> table_type;
+
+            public:
+                typedef static_digest<DigestBits> digest_type;
+                typedef Mapped mapped_type;
+
+                digest_map() {
+                }
+
+                explicit digest_map(std::size_t n) {
+                    reserve(n);
+                }
+
+                /*!
+                 * @brief Maps d to value unless d is already mapped.
+                 * @return Value mapped to d and whether it was inserted
+                 */
+                std::pair<mapped_type *, bool> insert(const digest_type &d, const mapped_type &value) {
+                    std::pair<typename table_type::slot_type *, bool> r = table.insert(d);
+                    if (r.second) {
+                        r.first->value = value;
+                    }
+                    return std::make_pair(&r.first->value, r.second);
+                }
+
+                /*!
+                 * @return Value mapped to d, or nullptr. It stays valid until the next insert.
+                 */
+                mapped_type *find(const digest_type &d) {
+                    typename table_type::slot_type *s = table.find(d);
+                    return s ? &s->value : nullptr;
+                }
+
+                const mapped_type *find(const digest_type &d) const {
+                    const typename table_type::slot_type *s = table.find(d);
+                    return s ? &s->value : nullptr;
+                }
+
+                bool contains(const digest_type &d) const {
+                    return table.find(d);
+                }
+
+                bool erase(const digest_type &d) {
+                    return table.erase(d);
+                }
+
+                std::size_t size() const {
+                    return table.size();
+                }
+
+                bool empty() const {
+                    return !size();
+                }
+
+                std::size_t capacity() const {
+                    return table.capacity();
+                }
+
+                void reserve(std::size_t n) {
+                    table.reserve(n);
+                }
+
+                void clear() {
+                    table.clear();
+                }
+
+                /*!
+                 * @brief Calls f(digest, value) for every entry, in no particular order.
+                 */
+                template<typename F>
+                void for_each(F f) const {
+                    table.for_each([&f](const typename table_type::slot_type &s) { f(s.key, s.value); });
+                }
+
+#ifdef BOOST_HAS_UNISTD_H
+                /*!
+                 * @brief Same as digest_set::open.
+                 */
+                bool open(const std::string &path, std::size_t n = 0) {
+                    return table.open(path, n);
+                }
+
+                bool sync() const {
+                    return table.sync();
+                }
+#endif
+
+            private:
+                table_type table;
+            };
+        }    // namespace hashes
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_DIGEST_INDEX_HPP
@@ -0,0 +1,368 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_HASH_PAIR_HPP
+#define CRYPTO3_HASH_HASH_PAIR_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#include <boost/endian/conversion.hpp>
+#include <boost/static_assert.hpp>
+
+#include <nil/crypto3/detail/octet.hpp>
+
+#include <nil/crypto3/hash/sha2.hpp>
+#include <nil/crypto3/hash/keccak.hpp>
+#include <nil/crypto3/hash/sha3.hpp>
+#include <nil/crypto3/hash/blake2b.hpp>
+#include <nil/crypto3/hash/static_hash.hpp>
+
+#include <nil/crypto3/hash/detail/sha2/sha2_256_lanes.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                /*!
+                 * @brief Message schedule of a constant SHA-256 block plus the round constants, in the layout
+                 * sha2_compressor::process_schedule() takes.
+                 */
+                constexpr inline std::array<sha2_functions<256>::word_type, sha2_functions<256>::rounds>
+                    sha2_256_schedule(const sha2_compressor<256>::block_type &block) {
+                    typedef sha2_functions<256> functions_type;
+
+                    std::array<functions_type::word_type, functions_type::rounds> wk = {};
+                    for (std::size_t t = 0; t != block.size(); ++t) {
+                        wk[t] = block[t];
+                    }
+                    for (std::size_t t = block.size(); t != functions_type::rounds; ++t) {
+                        wk[t] = functions_type::sigma_1(wk[t - 2]) + wk[t - 7] + functions_type::sigma_0(wk[t - 15]) +
+                                wk[t - 16];
+                    }
+                    for (std::size_t t = 0; t != functions_type::rounds; ++t) {
+                        wk[t] += functions_type::round_constants[t];
+                    }
+                    return wk;
+                }
+
+                /*!
+                 * @brief State of a Keccak-f[1600] sponge that absorbed nothing but the padding of a message of
+                 * MessageWords lanes, which are then xored (here: set) by the caller before the permutation.
+                 */
+                template<typename Functions, std::size_t MessageWords, std::uint8_t DomainOctet>
+                constexpr typename Functions::state_type keccak_1600_padded_state() {
+                    typename Functions::state_type state = {};
+                    state[MessageWords] = DomainOctet;
+                    state[Functions::block_words - 1] ^= UINT64_C(0x8000000000000000);
+                    return state;
+                }
+
+                /*!
+                 * @brief Fixed input length hashing of two digests of the same hash, i.e. the digest of
+                 * lhs || rhs as for the nodes of a binary Merkle tree. The message length being known, the
+                 * final padding is a constant computed once, and no accumulator is involved. Specialized per
+                 * hash family.
+                 * @tparam Hash
+                 */
+                template<typename Hash>
+                struct hash_pair_impl;
+
+                /*!
+                 * @brief SHA-256 of 64 octets: the data block, then a constant padding block compressed from
+                 * its precomputed message schedule. With the SHA extensions both blocks go to the SHA-NI
+                 * kernel instead, its hardware schedule being cheaper than the scalar rounds. Batches are
+                 * spread over the SHA-256 lane kernels.
+                 */
+                template<>
+                struct hash_pair_impl<sha2<256>> {
+                    typedef sha2_policy<256> policy_type;
+                    typedef sha2_compressor<256> compressor_type;
+
+                    typedef typename compressor_type::word_type word_type;
+                    typedef typename compressor_type::state_type state_type;
+                    typedef typename compressor_type::block_type block_type;
+                    typedef std::array<word_type, compressor_type::rounds> schedule_type;
+
+                    typedef typename policy_type::digest_type digest_type;
+
+                    constexpr static const std::size_t state_words = compressor_type::state_words;
+                    constexpr static const std::size_t block_words = compressor_type::block_words;
+                    constexpr static const std::size_t word_octets = compressor_type::word_bits / octet_bits;
+                    constexpr static const std::size_t digest_octets = policy_type::digest_bits / octet_bits;
+                    constexpr static const std::size_t block_octets = compressor_type::block_bits / octet_bits;
+
+                    /*!
+                     * @brief Padding block of a 64-octet message: a one bit, zeros and the length of 512 bits.
+                     */
+                    constexpr static const block_type padding = {{0x80000000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                                                                  0, 0, 0x200}};
+                    constexpr static const schedule_type padding_schedule = sha2_256_schedule(padding);
+
+                    static digest_type process(const octet_type *lhs, const octet_type *rhs) {
+                        std::array<word_type, 2 * block_words> blocks;
+                        std::memcpy(blocks.data(), lhs, digest_octets);
+                        std::memcpy(blocks.data() + state_words, rhs, digest_octets);
+                        for (std::size_t i = 0; i != block_words; ++i) {
+                            boost::endian::big_to_native_inplace(blocks[i]);
+                        }
+                        state_type state = policy_type::initial_state;
+
+#ifdef CRYPTO3_HAS_SHA_NI
+                        if (sha2_256_sha_ni::supported()) {
+                            std::copy(padding.begin(), padding.end(), blocks.begin() + block_words);
+                            sha2_256_sha_ni::process_blocks(state.data(), blocks.data(), 2);
+
+                            digest_type d;
+                            store(state.data(), 1, d);
+                            return d;
+                        }
+#endif
+
+                        compressor_type::process_blocks(state, blocks.data(), 1);
+                        compressor_type::process_schedule(state, padding_schedule.data());
+
+                        digest_type d;
+                        store(state.data(), 1, d);
+                        return d;
+                    }
+
+                    static void process(const digest_type *children, std::size_t n, digest_type *parents) {
+#ifdef CRYPTO3_HAS_X86_INTRINSICS
+                        if (n > sha2_256_avx2_lanes::lanes && sha2_256_avx512_lanes::supported()) {
+                            return process<sha2_256_avx512_lanes>(children, n, parents);
+                        }
+                        if (n > 1 && sha2_256_avx2_lanes::supported()) {
+                            return process<sha2_256_avx2_lanes>(children, n, parents);
+                        }
+#endif
+                        for (std::size_t i = 0; i != n; ++i) {
+                            parents[i] = process(children[2 * i].data(), children[2 * i + 1].data());
+                        }
+                    }
+
+                    /*!
+                     * @brief Hashes n pairs lanes at a time. Idle lanes of the last round repeat the last pair.
+                     */
+                    template<typename Kernel>
+                    static void process(const digest_type *children, std::size_t n, digest_type *parents) {
+                        constexpr static const std::size_t lanes = Kernel::lanes;
+
+                        alignas(64) word_type state[state_words * lanes];
+                        std::array<octet_type, block_octets * lanes> data;
+                        const octet_type *blocks[lanes];
+
+                        for (std::size_t first = 0; first < n; first += lanes) {
+                            const std::size_t count = std::min(lanes, n - first);
+                            for (std::size_t l = 0; l != lanes; ++l) {
+                                const std::size_t pair = first + std::min(l, count - 1);
+                                octet_type *block = data.data() + l * block_octets;
+                                std::memcpy(block, children[2 * pair].data(), digest_octets);
+                                std::memcpy(block + digest_octets, children[2 * pair + 1].data(), digest_octets);
+                                blocks[l] = block;
+                            }
+                            for (std::size_t i = 0; i != state_words; ++i) {
+                                std::fill(state + i * lanes, state + (i + 1) * lanes, policy_type::initial_state[i]);
+                            }
+
+                            Kernel::compress(state, blocks);
+                            Kernel::compress_schedule(state, padding_schedule.data());
+
+                            for (std::size_t l = 0; l != count; ++l) {
+                                store(state + l, lanes, parents[first + l]);
+                            }
+                        }
+                    }
+
+                protected:
+                    static void store(const word_type *state, std::size_t stride, digest_type &digest) {
+                        for (std::size_t i = 0; i != state_words; ++i) {
+                            word_type w = boost::endian::native_to_big(state[i * stride]);
+                            std::memcpy(digest.data() + i * word_octets, &w, word_octets);
+                        }
+                    }
+                };
+
+                /*!
+                 * @brief Keccak-f[1600] sponge of 2 * digest_bits bits, which fit in a single block: the
+                 * padded state is a constant, only the message lanes are filled in before the permutation.
+                 * @tparam Hash
+                 * @tparam Functions Provides permute() and the rate as block_bits
+                 * @tparam DomainOctet First padding octet: 0x01 for Keccak, 0x06 for SHA-3
+                 */
+                template<typename Hash, typename Functions, std::uint8_t DomainOctet>
+                struct keccak_1600_hash_pair_impl {
+                    typedef Functions functions_type;
+
+                    typedef typename functions_type::word_type word_type;
+                    typedef typename functions_type::state_type state_type;
+                    typedef typename Hash::digest_type digest_type;
+
+                    constexpr static const std::size_t word_octets = functions_type::word_bits / octet_bits;
+                    constexpr static const std::size_t rate_octets = functions_type::block_bits / octet_bits;
+                    constexpr static const std::size_t digest_octets = Hash::digest_bits / octet_bits;
+                    constexpr static const std::size_t message_octets = 2 * digest_octets;
+                    constexpr static const std::size_t message_words = message_octets / word_octets;
+
+                    BOOST_STATIC_ASSERT(message_octets % word_octets == 0);
+                    BOOST_STATIC_ASSERT(message_octets < rate_octets);
+
+                    constexpr static const state_type padded_state =
+                        keccak_1600_padded_state<functions_type, message_words, DomainOctet>();
+
+                    static digest_type process(const octet_type *lhs, const octet_type *rhs) {
+                        std::array<octet_type, message_octets> m;
+                        std::copy(lhs, lhs + digest_octets, m.begin());
+                        std::copy(rhs, rhs + digest_octets, m.begin() + digest_octets);
+
+                        state_type state = padded_state;
+                        for (std::size_t i = 0; i != message_words; ++i) {
+                            state[i] = load_little_octet<word_type>(m.data() + i * word_octets);
+                        }
+                        functions_type::permute(state);
+
+                        digest_type d;
+                        for (std::size_t i = 0; i != digest_octets; ++i) {
+                            d[i] = static_cast<octet_type>(state[i / word_octets] >> ((i % word_octets) * octet_bits));
+                        }
+                        return d;
+                    }
+
+                    static void process(const digest_type *children, std::size_t n, digest_type *parents) {
+                        for (std::size_t i = 0; i != n; ++i) {
+                            parents[i] = process(children[2 * i].data(), children[2 * i + 1].data());
+                        }
+                    }
+                };
+
+                template<typename Hash, typename Functions, std::uint8_t DomainOctet>
+                constexpr typename keccak_1600_hash_pair_impl<Hash, Functions, DomainOctet>::state_type const
+                    keccak_1600_hash_pair_impl<Hash, Functions, DomainOctet>::padded_state;
+
+                template<std::size_t DigestBits>
+                struct hash_pair_impl<keccak_1600<DigestBits>>
+                    : public keccak_1600_hash_pair_impl<keccak_1600<DigestBits>, keccak_1600_functions<DigestBits>,
+                                                        0x01> { };
+
+                template<std::size_t DigestBits>
+                struct hash_pair_impl<sha3<DigestBits>>
+                    : public keccak_1600_hash_pair_impl<sha3<DigestBits>, sha3_functions<DigestBits>, 0x06> { };
+
+                /*!
+                 * @brief BLAKE2b of 2 * digest_bits bits: a single final block. The parameter block is folded
+                 * into the initial state once; the message counter and the finalization flag are constants.
+                 */
+                template<std::size_t DigestBits>
+                struct hash_pair_impl<blake2b<DigestBits>> {
+                    typedef blake2b_compressor<DigestBits> compressor_type;
+
+                    typedef typename compressor_type::word_type word_type;
+                    typedef typename compressor_type::state_type state_type;
+                    typedef typename compressor_type::block_type block_type;
+                    typedef typename blake2b<DigestBits>::digest_type digest_type;
+
+                    constexpr static const std::size_t word_octets = compressor_type::word_bits / octet_bits;
+                    constexpr static const std::size_t digest_octets = DigestBits / octet_bits;
+                    constexpr static const std::size_t message_octets = 2 * digest_octets;
+                    constexpr static const std::size_t message_words = message_octets / word_octets;
+
+                    BOOST_STATIC_ASSERT(message_octets % word_octets == 0);
+                    BOOST_STATIC_ASSERT(message_octets <= compressor_type::block_bits / octet_bits);
+
+                    constexpr static state_type make_initial_state() {
+                        state_type state = {};
+                        for (std::size_t i = 0; i != compressor_type::state_words; ++i) {
+                            state[i] = typename compressor_type::iv_generator()()[i];
+                        }
+                        // Digest length, no key, fanout and depth 1
+                        state[0] ^= 0x01010000U ^ digest_octets;
+                        return state;
+                    }
+
+                    static digest_type process(const octet_type *lhs, const octet_type *rhs) {
+                        block_type block = {};
+                        for (std::size_t i = 0; i != message_words / 2; ++i) {
+                            block[i] = load_little_octet<word_type>(lhs + i * word_octets);
+                            block[message_words / 2 + i] = load_little_octet<word_type>(rhs + i * word_octets);
+                        }
+
+                        state_type state = initial_state;
+                        compressor_type::process_block(state, block, message_octets * octet_bits,
+                                                       compressor_type::salt_value);
+
+                        digest_type d;
+                        for (std::size_t i = 0; i != digest_octets; ++i) {
+                            d[i] = static_cast<octet_type>(state[i / word_octets] >> ((i % word_octets) * octet_bits));
+                        }
+                        return d;
+                    }
+
+                    static void process(const digest_type *children, std::size_t n, digest_type *parents) {
+                        for (std::size_t i = 0; i != n; ++i) {
+                            parents[i] = process(children[2 * i].data(), children[2 * i + 1].data());
+                        }
+                    }
+
+                protected:
+                    constexpr static const state_type initial_state = make_initial_state();
+                };
+
+                template<std::size_t DigestBits>
+                constexpr typename hash_pair_impl<blake2b<DigestBits>>::state_type const
+                    hash_pair_impl<blake2b<DigestBits>>::initial_state;
+            }    // namespace detail
+
+            /*!
+             * @brief Digest of the concatenation lhs || rhs of two digests of Hash, e.g. a binary Merkle tree
+             * node. Yields the same digest as hash<Hash>() over the 2 * digest_bits / 8 octets, without going
+             * through an accumulator and with the final padding precomputed. Supported for sha2<256>,
+             * keccak_1600, sha3 and blake2b.
+             * @ingroup hashes
+             * @tparam Hash
+             */
+            template<typename Hash>
+            typename Hash::digest_type hash_pair(const typename Hash::digest_type &lhs,
+                                                 const typename Hash::digest_type &rhs) {
+                return detail::hash_pair_impl<Hash>::process(lhs.data(), rhs.data());
+            }
+
+            /*!
+             * @brief Hashes n pairs: parents[i] = hash_pair<Hash>(children[2 * i], children[2 * i + 1]), i.e.
+             * one level of a binary Merkle tree. SHA-256 pairs are compressed several at a time on the SIMD
+             * lane kernels (16 lanes with AVX-512, 8 lanes with AVX2, selected at runtime). parents may be
+             * children, to reduce a level in place.
+             * @ingroup hashes
+             * @tparam Hash
+             */
+            template<typename Hash>
+            void hash_pairs(const typename Hash::digest_type *children, std::size_t n,
+                            typename Hash::digest_type *parents) {
+                detail::hash_pair_impl<Hash>::process(children, n, parents);
+            }
+        }    // namespace hashes
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_HASH_PAIR_HPP
@@ -0,0 +1,283 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_PIPELINE_HPP
+#define CRYPTO3_HASH_PIPELINE_HPP
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <istream>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_UNISTD_H
+#include <cerrno>
+#include <unistd.h>
+#endif
+
+#include <nil/crypto3/detail/octet.hpp>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/detail/aligned_buffer.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            /*!
+             * @brief Two-stage reader/hasher pipeline for streaming sources such as pipes, sockets or
+             * decompressor output. A reader thread fills a bounded ring of preallocated, page-aligned buffers
+             * while the calling thread feeds the filled ones to the hash accumulator, so reading and hashing
+             * overlap. Buffers are allocated once, in the constructor, and reused by every process call.
+             *
+             * Every buffer is filled completely (except at the end of the input) and holds a whole number of
+             * blocks, so the accumulator always receives block-aligned data. The digest equals hash<Hash>() of
+             * the concatenated input.
+             *
+             * @tparam Hash
+             */
+            template<typename Hash>
+            class hash_pipeline {
+            public:
+                typedef Hash hash_type;
+                typedef accumulator_set<hash_type> accumulator_type;
+                typedef typename hash_type::digest_type digest_type;
+
+                constexpr static const std::size_t block_octets = hash_type::block_bits / octet_bits;
+
+                explicit hash_pipeline(std::size_t buffers = 4, std::size_t buffer_octets = 1 << 20) :
+                    ring(std::max<std::size_t>(buffers, 2)), sizes(ring.size()),
+                    capacity(std::max(block_octets, buffer_octets / block_octets * block_octets)) {
+                    for (detail::aligned_buffer &b : ring) {
+                        b.reserve(capacity);
+                    }
+                }
+
+                /*!
+                 * @brief Feeds everything a source produces to acc.
+                 *
+                 * @param source Callable std::ptrdiff_t(octet_type *p, std::size_t n) storing up to n octets at
+                 * p and returning their number, 0 at the end of the input and a negative value on failure. It
+                 * is called on the reader thread.
+                 *
+                 * @return false if an allocation or the source failed, the accumulator state is unspecified
+                 * then.
+                 *
+                 * If the source or the accumulator throws, the reader thread is joined and the exception is
+                 * rethrown.
+                 */
+                template<typename Source>
+                typename std::enable_if<!std::is_integral<Source>::value &&
+                                            !std::is_base_of<std::istream, Source>::value,
+                                        bool>::type
+                    process(Source source, accumulator_type &acc) {
+                    for (const detail::aligned_buffer &b : ring) {
+                        if (!b.data()) {
+                            return false;
+                        }
+                    }
+
+                    filled = 0;
+                    finished = false;
+                    failed = false;
+                    cancelled = false;
+                    error = nullptr;
+
+                    {
+                        std::thread reader([this, &source]() { read(source); });
+                        reader_joiner joiner(*this, reader);
+
+                        std::size_t tail = 0;
+                        std::unique_lock<std::mutex> lock(mutex);
+                        while (true) {
+                            not_empty.wait(lock, [this]() { return filled || finished; });
+                            if (!filled || error) {
+                                break;
+                            }
+
+                            lock.unlock();
+                            const octet_type *p = ring[tail].data();
+                            ::nil::crypto3::hash<hash_type>(p, p + sizes[tail], acc);
+                            tail = (tail + 1) % ring.size();
+                            lock.lock();
+
+                            --filled;
+                            not_full.notify_one();
+                        }
+                    }
+
+                    if (error) {
+                        std::exception_ptr e = error;
+                        error = nullptr;
+                        std::rethrow_exception(e);
+                    }
+                    return !failed;
+                }
+
+                /*!
+                 * @brief Feeds the rest of a std::istream to acc.
+                 */
+                bool process(std::istream &in, accumulator_type &acc) {
+                    return process(
+                        [&in](octet_type *p, std::size_t n) -> std::ptrdiff_t {
+                            in.read(reinterpret_cast<char *>(p), n);
+                            return in.bad() ? -1 : in.gcount();
+                        },
+                        acc);
+                }
+
+#ifdef BOOST_HAS_UNISTD_H
+                /*!
+                 * @brief Feeds the rest of a file descriptor to acc.
+                 */
+                bool process(int fd, accumulator_type &acc) {
+                    return process(
+                        [fd](octet_type *p, std::size_t n) -> std::ptrdiff_t {
+                            ssize_t r;
+                            do {
+                                r = ::read(fd, p, n);
+                            } while (r < 0 && errno == EINTR);
+                            return r;
+                        },
+                        acc);
+                }
+#endif
+
+                /*!
+                 * @brief Computes the digest of the rest of an input (source, stream or descriptor).
+                 *
+                 * @return false if reading failed, digest is left unchanged then.
+                 */
+                template<typename Input>
+                bool operator()(Input &&input, digest_type &digest) {
+                    accumulator_type acc;
+                    if (!process(std::forward<Input>(input), acc)) {
+                        return false;
+                    }
+                    digest = accumulators::extract::hash<hash_type>(acc);
+                    return true;
+                }
+
+            protected:
+                /*!
+                 * @brief Stops and joins the reader thread when process returns or throws, so that it never
+                 * outlives the source or blocks on a ring nobody drains.
+                 */
+                class reader_joiner {
+                public:
+                    reader_joiner(hash_pipeline &pipeline, std::thread &reader) : pipeline(pipeline), reader(reader) {
+                    }
+
+                    ~reader_joiner() {
+                        {
+                            std::lock_guard<std::mutex> lock(pipeline.mutex);
+                            pipeline.cancelled = true;
+                        }
+                        pipeline.not_full.notify_one();
+                        reader.join();
+                    }
+
+                private:
+                    hash_pipeline &pipeline;
+                    std::thread &reader;
+                };
+
+                // Runs on the reader thread, where an escaping exception would terminate the process
+                template<typename Source>
+                void read(Source &source) {
+                    try {
+                        fill(source);
+                    } catch (...) {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        error = std::current_exception();
+                        finished = true;
+                        not_empty.notify_one();
+                    }
+                }
+
+                template<typename Source>
+                void fill(Source &source) {
+                    std::size_t head = 0;
+                    bool end = false;
+                    while (!end) {
+                        {
+                            std::unique_lock<std::mutex> lock(mutex);
+                            not_full.wait(lock, [this]() { return cancelled || filled != ring.size(); });
+                            if (cancelled) {
+                                return;
+                            }
+                        }
+
+                        octet_type *p = ring[head].data();
+                        std::size_t n = 0;
+                        while (n != capacity) {
+                            std::ptrdiff_t r = source(p + n, capacity - n);
+                            if (r < 0) {
+                                std::lock_guard<std::mutex> lock(mutex);
+                                failed = true;
+                                finished = true;
+                                not_empty.notify_one();
+                                return;
+                            }
+                            if (!r) {
+                                end = true;
+                                break;
+                            }
+                            n += r;
+                        }
+
+                        std::lock_guard<std::mutex> lock(mutex);
+                        if (n) {
+                            sizes[head] = n;
+                            head = (head + 1) % ring.size();
+                            ++filled;
+                        }
+                        finished = end;
+                        not_empty.notify_one();
+                    }
+                }
+
+                std::vector<detail::aligned_buffer> ring;
+                std::vector<std::size_t> sizes;
+                std::size_t capacity;
+
+                std::mutex mutex;
+                std::condition_variable not_empty;
+                std::condition_variable not_full;
+
+                std::size_t filled;
+                bool finished;
+                bool failed;
+                bool cancelled;
+                std::exception_ptr error;
+            };
+        }    // namespace hashes
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_PIPELINE_HPP
@@ -41,7 +41,34 @@ namespace nil {
             boost::accumulators::accumulator_set<static_digest<Hash::digest_bits>,
                                                  boost::accumulators::features<accumulators::tag::hash<Hash>>,
                                                  std::size_t>;
+
+        namespace accumulators {
+            /*!
+             * @brief Exports the mid-stream state of the hash accumulator in a versioned, endianness
+             * independent binary form, so that hashing can be resumed later with load_state.
+             */
+            template<typename Hash, typename AccumulatorSet, typename OutputIterator>
+            OutputIterator save_state(const AccumulatorSet &acc, OutputIterator out) {
+                return boost::accumulators::find_accumulator<tag::hash<Hash>>(acc).save(out);
+            }
+
+            /*!
+             * @brief Restores the mid-stream state of the hash accumulator from the output of save_state. The
+             * bits_count feature resumes from the restored message length as well.
+             * @return false if the input is malformed or was saved for another hash, acc is left untouched then
+             */
+            template<typename Hash, typename AccumulatorSet, typename InputIterator>
+            bool load_state(AccumulatorSet &acc, InputIterator first, InputIterator last) {
+                auto &hash_acc = boost::accumulators::find_accumulator<tag::hash<Hash>>(acc);
+                if (!hash_acc.load(first, last)) {
+                    return false;
+                }
+
+                boost::accumulators::find_accumulator<tag::bits_count>(acc).restore(hash_acc.bits_seen());
+                return true;
+            }
+        }    // namespace accumulators
     }    // namespace crypto3
 }    // namespace nil
 
-#endif    // CRYPTO3_BLOCK_STREAM_PREPROCESSOR_HPP
\ No newline at end of file
+#endif    // CRYPTO3_HASH_STATE_HPP
\ No newline at end of file
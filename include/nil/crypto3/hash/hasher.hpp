@@ -0,0 +1,246 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_HASHER_HPP
+#define CRYPTO3_HASH_HASHER_HPP
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <type_traits>
+
+#include <boost/integer.hpp>
+#include <boost/static_assert.hpp>
+
+#include <nil/crypto3/detail/octet.hpp>
+#include <nil/crypto3/detail/pack.hpp>
+#include <nil/crypto3/detail/type_traits.hpp>
+
+#include <nil/crypto3/hash/detail/block_run.hpp>
+#include <nil/crypto3/hash/detail/instrument.hpp>
+#include <nil/crypto3/hash/detail/state_serializer.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            /*!
+             * @brief Plain init/update/finalize interface to a hash. It drives Hash::construction::type
+             * directly, without Boost.Accumulators, and produces the same digests as accumulator_set<Hash>.
+             *
+             * @tparam Hash
+             * @tparam ValueBits Size of a single input value in bits
+             */
+            template<typename Hash, std::size_t ValueBits = octet_bits>
+            class hasher {
+            public:
+                typedef Hash hash_type;
+                typedef typename hash_type::construction::type construction_type;
+                typedef typename hash_type::construction::params_type params_type;
+                typedef typename hash_type::digest_type digest_type;
+
+                typedef typename params_type::digest_endian endian_type;
+
+                constexpr static const std::size_t word_bits = construction_type::word_bits;
+                typedef typename construction_type::word_type word_type;
+
+                constexpr static const std::size_t block_bits = construction_type::block_bits;
+                constexpr static const std::size_t block_words = construction_type::block_words;
+                typedef typename construction_type::block_type block_type;
+
+                constexpr static const std::size_t value_bits = ValueBits;
+                typedef typename boost::uint_t<value_bits>::least value_type;
+                BOOST_STATIC_ASSERT(word_bits % value_bits == 0);
+                BOOST_STATIC_ASSERT(block_bits % value_bits == 0);
+                constexpr static const std::size_t block_values = block_bits / value_bits;
+                typedef std::array<value_type, block_values> cache_type;
+
+                typedef detail::state_serializer<construction_type> serializer_type;
+                constexpr static const std::size_t serialized_octets = serializer_type::serialized_octets;
+
+                hasher() : cache(), cache_seen(0), total_seen(0) {
+                    CRYPTO3_HASH_INSTRUMENT_NAME(construction_type, hash_type);
+                }
+
+                /*!
+                 * @brief Absorbs n values stored contiguously starting at first.
+                 */
+                template<typename T>
+                hasher &update(const T *first, std::size_t n) {
+                    BOOST_STATIC_ASSERT(sizeof(T) * CHAR_BIT == value_bits);
+
+                    while (n) {
+                        if (cache_seen == block_values) {
+                            process_cache();
+                        }
+
+                        if (!cache_seen) {
+                            // Whole blocks are packed straight from the input and compressed in runs. The last
+                            // one is kept in the cache, because the construction may need to process it as the
+                            // final block.
+                            while (n > block_values) {
+                                std::size_t blocks = std::min((n - 1) / block_values, detail::block_run_blocks);
+                                word_type words[detail::block_run_blocks * block_words];
+                                ::nil::crypto3::detail::pack_to<endian_type, value_bits, word_bits>(
+                                    first, first + blocks * block_values, words);
+                                construction.process_blocks(words, blocks, total_seen + block_bits);
+                                total_seen += blocks * block_bits;
+                                first += blocks * block_values;
+                                n -= blocks * block_values;
+                            }
+                        }
+
+                        std::size_t count = std::min(n, block_values - cache_seen);
+                        std::copy(first, first + count, cache.begin() + cache_seen);
+                        cache_seen += count;
+                        total_seen += count * value_bits;
+                        first += count;
+                        n -= count;
+                    }
+
+                    return *this;
+                }
+
+                template<typename InputIterator>
+                hasher &update(InputIterator first, InputIterator last) {
+                    return update(first, last,
+                                  std::integral_constant<bool, is_contiguous_input<InputIterator>::value>());
+                }
+
+                /*!
+                 * @brief Absorbs a range of values, e.g. a std::vector, std::string or std::span.
+                 */
+                template<typename SinglePassRange>
+                hasher &update(const SinglePassRange &r) {
+                    return update(std::begin(r), std::end(r));
+                }
+
+                /*!
+                 * @brief Computes the digest of everything absorbed since the last reset. The hasher is reset
+                 * afterwards and can be reused for the next message.
+                 */
+                digest_type finalize() {
+                    std::fill(cache.begin() + cache_seen, cache.end(), value_type());
+
+                    block_type block;
+                    ::nil::crypto3::detail::pack_to<endian_type, value_bits, word_bits>(cache.begin(), cache.end(),
+                                                                                      block.begin());
+                    digest_type d = construction.digest(block, total_seen);
+
+                    reset();
+                    return d;
+                }
+
+                void reset() {
+                    construction.reset();
+                    cache_seen = 0;
+                    total_seen = 0;
+                }
+
+                /*!
+                 * @brief Writes the mid-stream state in the portable format of detail::state_serializer, which
+                 * takes serialized_octets octets. The same format is used by accumulators::save_state.
+                 */
+                template<typename OutputIterator>
+                OutputIterator save(OutputIterator out) const {
+                    cache_type values = cache;
+                    std::fill(values.begin() + cache_seen, values.end(), value_type());
+
+                    block_type block;
+                    ::nil::crypto3::detail::pack_to<endian_type, value_bits, word_bits>(values.begin(), values.end(),
+                                                                                      block.begin());
+                    return serializer_type::save(construction.state(), block, total_seen, out);
+                }
+
+                /*!
+                 * @brief Replaces the mid-stream state with one written by save or accumulators::save_state.
+                 * @return false if the input is malformed or was saved for another hash, the hasher is left
+                 * untouched then
+                 */
+                template<typename InputIterator>
+                bool load(InputIterator first, InputIterator last) {
+                    typename construction_type::state_type state;
+                    block_type block;
+                    std::uint64_t seen;
+
+                    if (!serializer_type::load(first, last, state, block, seen) || seen % value_bits) {
+                        return false;
+                    }
+
+                    construction.restore(state);
+                    ::nil::crypto3::detail::pack_from<endian_type, word_bits, value_bits>(block.begin(), block.end(),
+                                                                                        cache.begin());
+                    total_seen = seen;
+                    cache_seen = (total_seen % block_bits) / value_bits;
+                    if (total_seen && !cache_seen) {
+                        cache_seen = block_values;
+                    }
+                    return true;
+                }
+
+            protected:
+                template<typename InputIterator>
+                struct is_contiguous_input {
+                    typedef typename std::iterator_traits<InputIterator>::value_type input_value_type;
+
+                    constexpr static const bool value =
+                        ::nil::crypto3::detail::is_contiguous_iterator<InputIterator>::value &&
+                        std::is_integral<input_value_type>::value && sizeof(input_value_type) * CHAR_BIT == value_bits;
+                };
+
+                template<typename InputIterator>
+                hasher &update(InputIterator first, InputIterator last, std::true_type) {
+                    return first == last ? *this : update(&*first, std::distance(first, last));
+                }
+
+                template<typename InputIterator>
+                hasher &update(InputIterator first, InputIterator last, std::false_type) {
+                    for (; first != last; ++first) {
+                        if (cache_seen == block_values) {
+                            process_cache();
+                        }
+                        cache[cache_seen++] = static_cast<value_type>(*first);
+                        total_seen += value_bits;
+                    }
+                    return *this;
+                }
+
+                inline void process_cache() {
+                    block_type block;
+                    ::nil::crypto3::detail::pack_to<endian_type, value_bits, word_bits>(cache.begin(), cache.end(),
+                                                                                      block.begin());
+                    construction.process_block(block, total_seen);
+                    cache_seen = 0;
+                }
+
+                construction_type construction;
+
+                cache_type cache;
+                std::size_t cache_seen;
+                std::size_t total_seen;
+            };
+        }    // namespace hashes
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_HASHER_HPP
@@ -68,6 +68,28 @@ namespace nil {
                     for (std::size_t i = 0; i != state_words; ++i)
                         boost::endian::endian_reverse_inplace(state[i]);
                 }
+
+                /*!
+                 * @brief Processes n consecutive blocks of block_words words each. The state lanes are
+                 * byte-swapped once for the whole run instead of around every permutation.
+                 */
+                static void process_blocks(state_type &state, const word_type *blocks, std::size_t n) {
+                    if (!n)
+                        return;
+
+                    for (std::size_t i = 0; i != state_words; ++i)
+                        boost::endian::endian_reverse_inplace(state[i]);
+
+                    for (; n; --n, blocks += block_words) {
+                        for (std::size_t i = 0; i != block_words; ++i)
+                            state[i] ^= boost::endian::endian_reverse(blocks[i]);
+
+                        policy_type::permute(state);
+                    }
+
+                    for (std::size_t i = 0; i != state_words; ++i)
+                        boost::endian::endian_reverse_inplace(state[i]);
+                }
             };
 
             /*!
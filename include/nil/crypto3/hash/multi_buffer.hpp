@@ -0,0 +1,123 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_MULTI_BUFFER_HPP
+#define CRYPTO3_HASH_MULTI_BUFFER_HPP
+
+#include <iterator>
+#include <vector>
+
+#include <boost/static_assert.hpp>
+
+#include <nil/crypto3/detail/octet.hpp>
+
+#include <nil/crypto3/hash/hasher.hpp>
+#include <nil/crypto3/hash/sha2.hpp>
+#include <nil/crypto3/hash/sha256d.hpp>
+
+#include <nil/crypto3/hash/detail/sha2/sha2_256_multi_buffer.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                template<typename Hash>
+                struct basic_multi_buffer {
+                    typedef typename Hash::digest_type digest_type;
+
+                    static void process(const octet_type *const *messages, const std::size_t *sizes,
+                                        std::size_t count, digest_type *digests) {
+                        hasher<Hash> h;
+                        for (std::size_t i = 0; i != count; ++i) {
+                            digests[i] = h.update(messages[i], sizes[i]).finalize();
+                        }
+                    }
+                };
+
+                template<typename Hash>
+                struct multi_buffer_engine {
+                    typedef basic_multi_buffer<Hash> type;
+                };
+
+                template<>
+                struct multi_buffer_engine<sha2<224>> {
+                    typedef sha2_256_multi_buffer<224> type;
+                };
+
+                template<>
+                struct multi_buffer_engine<sha2<256>> {
+                    typedef sha2_256_multi_buffer<256> type;
+                };
+
+                template<>
+                struct multi_buffer_engine<sha256d> {
+                    typedef sha2_256_multi_buffer<256, 2> type;
+                };
+            }    // namespace detail
+
+            /*!
+             * @brief Hashes batches of independent messages. Hashes with a SIMD multi-buffer engine (SHA-224,
+             * SHA-256 and SHA-256d: 16 lanes with AVX-512, 8 lanes with AVX2, selected at runtime) compress
+             * several messages in lockstep; the others hash the messages one after another.
+             *
+             * @tparam Hash
+             */
+            template<typename Hash>
+            struct multi_buffer {
+                typedef typename Hash::digest_type digest_type;
+                typedef typename detail::multi_buffer_engine<Hash>::type engine_type;
+
+                /*!
+                 * @brief Hashes count messages. messages[i] points to sizes[i] octets, its digest is written to
+                 * digests[i]. Messages may have different lengths.
+                 */
+                static void process(const octet_type *const *messages, const std::size_t *sizes, std::size_t count,
+                                    digest_type *digests) {
+                    engine_type::process(messages, sizes, count, digests);
+                }
+
+                /*!
+                 * @brief Hashes every element of a range of contiguous octet ranges, e.g. a
+                 * std::vector<std::string>, and writes one digest per element to out.
+                 */
+                template<typename SinglePassRange, typename OutputIterator>
+                static OutputIterator process(const SinglePassRange &messages, OutputIterator out) {
+                    std::vector<const octet_type *> pointers;
+                    std::vector<std::size_t> sizes;
+                    for (const auto &m : messages) {
+                        BOOST_STATIC_ASSERT(sizeof(*std::data(m)) == sizeof(octet_type));
+                        pointers.push_back(reinterpret_cast<const octet_type *>(std::data(m)));
+                        sizes.push_back(std::size(m));
+                    }
+
+                    std::vector<digest_type> digests(pointers.size());
+                    process(pointers.data(), sizes.data(), pointers.size(), digests.data());
+                    return std::copy(digests.begin(), digests.end(), out);
+                }
+            };
+        }    // namespace hashes
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_MULTI_BUFFER_HPP
@@ -47,6 +47,17 @@ namespace nil {
                     // for (std::size_t i = 0; i != state_words; ++i)
                     //     boost::endian::endian_reverse_inplace(state[i]);
                 }
+
+                /*!
+                 * @brief Processes n consecutive blocks of block_words words each.
+                 */
+                static void process_blocks(state_type &state, const word_type *blocks, std::size_t n) {
+                    block_type block;
+                    for (; n; --n, blocks += block_words) {
+                        std::copy(blocks, blocks + block_words, block.begin());
+                        process_block(state, block);
+                    }
+                }
             };
 
             template<typename FieldType, std::size_t Arity, std::size_t PartRounds>
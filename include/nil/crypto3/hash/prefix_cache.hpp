@@ -0,0 +1,117 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_PREFIX_CACHE_HPP
+#define CRYPTO3_HASH_PREFIX_CACHE_HPP
+
+#include <iterator>
+
+#include <nil/crypto3/hash/hasher.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            /*!
+             * @brief Midstate cache for hashing many messages which share a common prefix, e.g. a
+             * domain-separation tag, a protocol header or a key.
+             *
+             * The prefix is absorbed once. The resulting construction state together with the partially
+             * filled block is kept as a snapshot, and every message starts from a copy of it instead of
+             * recompressing the prefix from the IV.
+             *
+             * @tparam Hash
+             * @tparam ValueBits Size of a single input value in bits
+             */
+            template<typename Hash, std::size_t ValueBits = octet_bits>
+            class prefix_cache {
+            public:
+                typedef hasher<Hash, ValueBits> hasher_type;
+                typedef typename hasher_type::digest_type digest_type;
+
+                prefix_cache() {
+                }
+
+                template<typename SinglePassRange>
+                explicit prefix_cache(const SinglePassRange &prefix) {
+                    snapshot.update(prefix);
+                }
+
+                template<typename InputIterator>
+                prefix_cache(InputIterator first, InputIterator last) {
+                    snapshot.update(first, last);
+                }
+
+                /*!
+                 * @brief Appends more values to the cached prefix.
+                 */
+                template<typename SinglePassRange>
+                prefix_cache &update(const SinglePassRange &r) {
+                    snapshot.update(r);
+                    return *this;
+                }
+
+                template<typename InputIterator>
+                prefix_cache &update(InputIterator first, InputIterator last) {
+                    snapshot.update(first, last);
+                    return *this;
+                }
+
+                /*!
+                 * @brief Returns a hasher that has already absorbed the prefix.
+                 */
+                const hasher_type &state() const {
+                    return snapshot;
+                }
+
+                /*!
+                 * @brief Rewinds h to the state right after the prefix, so that it can be reused without
+                 * constructing a new hasher per message.
+                 */
+                void restore(hasher_type &h) const {
+                    h = snapshot;
+                }
+
+                /*!
+                 * @brief Computes the digest of the prefix followed by the message.
+                 */
+                template<typename SinglePassRange>
+                digest_type operator()(const SinglePassRange &message) const {
+                    hasher_type h = snapshot;
+                    return h.update(message).finalize();
+                }
+
+                template<typename InputIterator>
+                digest_type operator()(InputIterator first, InputIterator last) const {
+                    hasher_type h = snapshot;
+                    return h.update(first, last).finalize();
+                }
+
+            protected:
+                hasher_type snapshot;
+            };
+        }    // namespace hashes
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_PREFIX_CACHE_HPP
@@ -36,6 +36,9 @@
 namespace nil {
     namespace crypto3 {
         namespace hashes {
+            template<std::size_t DigestBits>
+            struct ripemd_compressor;
+
             template<std::size_t DigestBits>
             struct basic_ripemd_compressor {
                 typedef detail::ripemd_functions<DigestBits> policy_type;
@@ -50,6 +53,17 @@ namespace nil {
                 constexpr static const std::size_t block_bits = policy_type::block_bits;
                 constexpr static const std::size_t block_words = policy_type::block_words;
                 typedef typename policy_type::block_type block_type;
+
+                /*!
+                 * @brief Processes n consecutive blocks of block_words words each.
+                 */
+                static void process_blocks(state_type &state, const word_type *blocks, std::size_t n) {
+                    block_type block;
+                    for (; n; --n, blocks += block_words) {
+                        std::copy(blocks, blocks + block_words, block.begin());
+                        ripemd_compressor<DigestBits>::process_block(state, block);
+                    }
+                }
             };
 
             template<std::size_t DigestBits>
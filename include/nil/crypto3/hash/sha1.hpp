@@ -30,6 +30,8 @@
 #include <nil/crypto3/hash/detail/sha1/sha1_policy.hpp>
 #include <nil/crypto3/hash/detail/state_adder.hpp>
 #include <nil/crypto3/hash/detail/davies_meyer_compressor.hpp>
+#include <nil/crypto3/hash/detail/dispatching_compressor.hpp>
+#include <nil/crypto3/hash/detail/sha1/sha1_sha_ni.hpp>
 #include <nil/crypto3/hash/detail/merkle_damgard_construction.hpp>
 #include <nil/crypto3/hash/detail/block_stream_processor.hpp>
 #include <nil/crypto3/hash/detail/merkle_damgard_padding.hpp>
@@ -40,13 +42,21 @@ namespace nil {
             /*!
              * @brief SHA1. Widely adopted NSA designed hashes function. Starting
              * to show significant signs of weakness, and collisions can now be
-             * generated. Avoid in new designs.
+             * generated. Avoid in new designs. Compresses with the SHA extensions
+             * where the CPU has them.
              * @ingroup hashes
              */
             class sha1 {
                 typedef detail::sha1_policy policy_type;
                 typedef typename policy_type::block_cipher_type block_cipher_type;
 
+                typedef davies_meyer_compressor<block_cipher_type, detail::state_adder> portable_compressor_type;
+#ifdef CRYPTO3_HAS_SHA_NI
+                typedef detail::dispatching_compressor<portable_compressor_type, detail::sha1_sha_ni> compressor_type;
+#else
+                typedef portable_compressor_type compressor_type;
+#endif
+
             public:
                 constexpr static const std::size_t word_bits = policy_type::word_bits;
                 typedef typename policy_type::word_type word_type;
@@ -67,8 +77,7 @@ namespace nil {
                     };
 
                     typedef merkle_damgard_construction<params_type, typename policy_type::iv_generator,
-                                                        davies_meyer_compressor<block_cipher_type, detail::state_adder>,
-                                                        detail::merkle_damgard_padding<policy_type>>
+                                                        compressor_type, detail::merkle_damgard_padding<policy_type>>
                         type;
                 };
 
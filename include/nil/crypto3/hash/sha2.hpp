@@ -28,8 +28,10 @@
 #define CRYPTO3_HASH_SHA2_HPP
 
 #include <nil/crypto3/hash/detail/sha2/sha2_policy.hpp>
-#include <nil/crypto3/hash/detail/state_adder.hpp>
-#include <nil/crypto3/hash/detail/davies_meyer_compressor.hpp>
+#include <nil/crypto3/hash/detail/sha2/sha2_compressor.hpp>
+#include <nil/crypto3/hash/detail/dispatching_compressor.hpp>
+#include <nil/crypto3/hash/detail/sha2/sha2_256_sha_ni.hpp>
+#include <nil/crypto3/hash/detail/sha2/sha2_512_avx2.hpp>
 #include <nil/crypto3/hash/detail/merkle_damgard_construction.hpp>
 #include <nil/crypto3/hash/detail/block_stream_processor.hpp>
 #include <nil/crypto3/hash/detail/merkle_damgard_padding.hpp>
@@ -37,15 +39,40 @@
 namespace nil {
     namespace crypto3 {
         namespace hashes {
+            namespace detail {
+                template<std::size_t CipherVersion>
+                struct sha2_compressor_engine {
+                    typedef sha2_compressor<CipherVersion> type;
+                };
+
+#ifdef CRYPTO3_HAS_SHA_NI
+                template<>
+                struct sha2_compressor_engine<256> {
+                    typedef dispatching_compressor<sha2_compressor<256>, sha2_256_sha_ni> type;
+                };
+#endif
+
+#ifdef CRYPTO3_HAS_X86_INTRINSICS
+                template<>
+                struct sha2_compressor_engine<512> {
+                    typedef dispatching_compressor<sha2_compressor<512>, sha2_512_avx2> type;
+                };
+#endif
+            }    // namespace detail
+
             /*!
-             * @brief SHA2
-             * @tparam Version
+             * @brief SHA2. Selected at runtime, SHA-224/256 compress with the SHA extensions and SHA-384/512 expand
+             * the message schedule with AVX2, two blocks at a time, where the CPU has them.
+             * @tparam Version digest size in bits
+             * @tparam CipherVersion compression word size: 512 with Version 224 or 256 selects SHA-512/224 and
+             * SHA-512/256
              * @ingroup hashes
              */
-            template<std::size_t Version>
+            template<std::size_t Version, std::size_t CipherVersion = (Version > 256 ? 512 : 256)>
             class sha2 {
-                typedef detail::sha2_policy<Version> policy_type;
-                typedef typename policy_type::block_cipher_type block_cipher_type;
+                typedef detail::sha2_policy<Version, CipherVersion> policy_type;
+
+                typedef typename detail::sha2_compressor_engine<policy_type::cipher_version>::type compressor_type;
 
             public:
                 constexpr static const std::size_t version = Version;
@@ -75,8 +102,7 @@ namespace nil {
                     };
 
                     typedef merkle_damgard_construction<params_type, typename policy_type::iv_generator,
-                                                        davies_meyer_compressor<block_cipher_type, detail::state_adder>,
-                                                        detail::merkle_damgard_padding<policy_type>>
+                                                        compressor_type, detail::merkle_damgard_padding<policy_type>>
                         type;
                 };
 
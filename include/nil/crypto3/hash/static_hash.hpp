@@ -0,0 +1,290 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_STATIC_HASH_HPP
+#define CRYPTO3_HASH_STATIC_HASH_HPP
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+#include <boost/static_assert.hpp>
+
+#include <nil/crypto3/detail/octet.hpp>
+
+#include <nil/crypto3/hash/detail/sha2/sha2_compressor.hpp>
+
+#include <nil/crypto3/hash/sha2.hpp>
+#include <nil/crypto3/hash/keccak.hpp>
+#include <nil/crypto3/hash/sha3.hpp>
+#include <nil/crypto3/hash/blake2b.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                template<typename OctetType>
+                constexpr inline std::uint8_t static_octet(OctetType value) {
+                    return static_cast<std::uint8_t>(value);
+                }
+
+                template<typename Word, typename OctetType>
+                constexpr inline Word load_big_octet(const OctetType *in) {
+                    Word w = 0;
+                    for (std::size_t i = 0; i != sizeof(Word); ++i) {
+                        w = (w << octet_bits) | static_octet(in[i]);
+                    }
+                    return w;
+                }
+
+                template<typename Word, typename OctetType>
+                constexpr inline Word load_little_octet(const OctetType *in) {
+                    Word w = 0;
+                    for (std::size_t i = sizeof(Word); i; --i) {
+                        w = (w << octet_bits) | static_octet(in[i - 1]);
+                    }
+                    return w;
+                }
+
+                /*!
+                 * @brief Constant expression counterpart of Hash::construction, which digests a whole octet
+                 * message at once. Specialized per hash family.
+                 * @tparam Hash
+                 */
+                template<typename Hash>
+                struct static_hash_impl;
+
+                template<std::size_t Version, std::size_t CipherVersion>
+                struct static_hash_impl<sha2<Version, CipherVersion>> {
+                    typedef sha2_policy<Version, CipherVersion> policy_type;
+                    typedef sha2_compressor<policy_type::cipher_version> compressor_type;
+
+                    typedef typename compressor_type::word_type word_type;
+                    typedef typename compressor_type::state_type state_type;
+                    typedef typename compressor_type::block_type block_type;
+
+                    constexpr static const std::size_t word_octets = compressor_type::word_bits / octet_bits;
+                    constexpr static const std::size_t block_octets = compressor_type::block_bits / octet_bits;
+                    constexpr static const std::size_t length_octets = policy_type::length_bits / octet_bits;
+
+                    constexpr static const std::size_t digest_octets = policy_type::digest_bits / octet_bits;
+                    typedef typename policy_type::digest_type digest_type;
+
+                    template<typename OctetType>
+                    constexpr static void process_block(state_type &state, const OctetType *in) {
+                        block_type block = {};
+                        for (std::size_t i = 0; i != compressor_type::block_words; ++i) {
+                            block[i] = load_big_octet<word_type>(in + i * word_octets);
+                        }
+                        compressor_type::process_block(state, block);
+                    }
+
+                    template<typename OctetType>
+                    constexpr static digest_type process(const OctetType *in, std::size_t n) {
+                        state_type state = {};
+                        for (std::size_t i = 0; i != compressor_type::state_words; ++i) {
+                            state[i] = typename policy_type::iv_generator()()[i];
+                        }
+
+                        const std::uint64_t length = static_cast<std::uint64_t>(n) * octet_bits;
+                        for (; n >= block_octets; n -= block_octets, in += block_octets) {
+                            process_block(state, in);
+                        }
+
+                        // Merkle-Damgard strengthening: 0x80, zeros and the big endian message length in bits
+                        std::array<std::uint8_t, 2 * block_octets> tail = {};
+                        for (std::size_t i = 0; i != n; ++i) {
+                            tail[i] = static_octet(in[i]);
+                        }
+                        tail[n] = 0x80;
+
+                        const std::size_t tail_octets = n + 1 + length_octets > block_octets ? 2 * block_octets :
+                                                                                               block_octets;
+                        for (std::size_t i = 0; i != sizeof(length); ++i) {
+                            tail[tail_octets - 1 - i] = static_octet(length >> (i * octet_bits));
+                        }
+                        for (std::size_t offset = 0; offset != tail_octets; offset += block_octets) {
+                            process_block(state, tail.data() + offset);
+                        }
+
+                        digest_type d = {};
+                        for (std::size_t i = 0; i != digest_octets; ++i) {
+                            d[i] = static_octet(state[i / word_octets] >>
+                                                ((word_octets - 1 - i % word_octets) * octet_bits));
+                        }
+                        return d;
+                    }
+                };
+
+                /*!
+                 * @brief Keccak-f[1600] sponge over natural (little endian) lanes.
+                 * @tparam Functions Provides permute() and the rate as block_bits
+                 * @tparam DomainOctet First padding octet: 0x01 for Keccak, 0x06 for SHA-3
+                 */
+                template<typename Functions, std::uint8_t DomainOctet>
+                struct static_keccak_1600_hash_impl {
+                    typedef Functions functions_type;
+
+                    typedef typename functions_type::word_type word_type;
+                    typedef typename functions_type::state_type state_type;
+
+                    constexpr static const std::size_t word_octets = functions_type::word_bits / octet_bits;
+                    constexpr static const std::size_t rate_octets = functions_type::block_bits / octet_bits;
+
+                    constexpr static const std::size_t digest_octets = functions_type::digest_bits / octet_bits;
+                    typedef typename functions_type::digest_type digest_type;
+
+                    template<typename OctetType>
+                    constexpr static void absorb(state_type &state, const OctetType *in) {
+                        for (std::size_t i = 0; i != functions_type::block_words; ++i) {
+                            state[i] ^= load_little_octet<word_type>(in + i * word_octets);
+                        }
+                        functions_type::permute(state);
+                    }
+
+                    template<typename OctetType>
+                    constexpr static digest_type process(const OctetType *in, std::size_t n) {
+                        state_type state = {};
+
+                        for (; n >= rate_octets; n -= rate_octets, in += rate_octets) {
+                            absorb(state, in);
+                        }
+
+                        std::array<std::uint8_t, rate_octets> tail = {};
+                        for (std::size_t i = 0; i != n; ++i) {
+                            tail[i] = static_octet(in[i]);
+                        }
+                        tail[n] ^= DomainOctet;
+                        tail[rate_octets - 1] ^= 0x80;
+                        absorb(state, tail.data());
+
+                        digest_type d = {};
+                        for (std::size_t i = 0; i != digest_octets; ++i) {
+                            d[i] = static_octet(state[i / word_octets] >> ((i % word_octets) * octet_bits));
+                        }
+                        return d;
+                    }
+                };
+
+                template<std::size_t DigestBits>
+                struct static_hash_impl<keccak_1600<DigestBits>>
+                    : public static_keccak_1600_hash_impl<keccak_1600_functions<DigestBits>, 0x01> { };
+
+                template<std::size_t DigestBits>
+                struct static_hash_impl<sha3<DigestBits>>
+                    : public static_keccak_1600_hash_impl<sha3_functions<DigestBits>, 0x06> { };
+
+                template<std::size_t DigestBits>
+                struct static_hash_impl<blake2b<DigestBits>> {
+                    typedef blake2b_compressor<DigestBits> compressor_type;
+
+                    typedef typename compressor_type::word_type word_type;
+                    typedef typename compressor_type::state_type state_type;
+                    typedef typename compressor_type::block_type block_type;
+
+                    constexpr static const std::size_t word_octets = compressor_type::word_bits / octet_bits;
+                    constexpr static const std::size_t block_octets = compressor_type::block_bits / octet_bits;
+
+                    constexpr static const std::size_t digest_octets = DigestBits / octet_bits;
+                    typedef typename blake2b<DigestBits>::digest_type digest_type;
+
+                    template<typename OctetType>
+                    constexpr static void process_block(state_type &state, const OctetType *in, std::uint64_t seen,
+                                                        word_type finalization) {
+                        block_type block = {};
+                        for (std::size_t i = 0; i != compressor_type::block_words; ++i) {
+                            block[i] = load_little_octet<word_type>(in + i * word_octets);
+                        }
+                        compressor_type::process_block(state, block, seen * octet_bits, finalization);
+                    }
+
+                    template<typename OctetType>
+                    constexpr static digest_type process(const OctetType *in, std::size_t n) {
+                        state_type state = {};
+                        for (std::size_t i = 0; i != compressor_type::state_words; ++i) {
+                            state[i] = typename compressor_type::iv_generator()()[i];
+                        }
+                        state[0] ^= 0x01010000U ^ digest_octets;
+
+                        // The last block, even when full, is the one compressed with the finalization flag
+                        std::uint64_t seen = 0;
+                        for (; n > block_octets; n -= block_octets, in += block_octets) {
+                            seen += block_octets;
+                            process_block(state, in, seen, 0);
+                        }
+
+                        std::array<std::uint8_t, block_octets> tail = {};
+                        for (std::size_t i = 0; i != n; ++i) {
+                            tail[i] = static_octet(in[i]);
+                        }
+                        seen += n;
+                        process_block(state, tail.data(), seen, compressor_type::salt_value);
+
+                        digest_type d = {};
+                        for (std::size_t i = 0; i != digest_octets; ++i) {
+                            d[i] = static_octet(state[i / word_octets] >> ((i % word_octets) * octet_bits));
+                        }
+                        return d;
+                    }
+                };
+            }    // namespace detail
+
+            /*!
+             * @brief Computes the digest of an octet range in a constant expression, so that
+             * constexpr auto d = static_hash<sha2<256>>("literal") costs nothing at runtime. Supported for
+             * sha2, keccak_1600, sha3 and blake2b. Yields the same digest as hash<Hash>() over the same octets.
+             * @ingroup hashes
+             * @tparam Hash
+             * @tparam OctetType
+             * @param data
+             * @param size Number of octets
+             */
+            template<typename Hash, typename OctetType>
+            constexpr typename Hash::digest_type static_hash(const OctetType *data, std::size_t size) {
+                BOOST_STATIC_ASSERT(sizeof(OctetType) == 1);
+                return detail::static_hash_impl<Hash>::process(data, size);
+            }
+
+            /*!
+             * @brief Computes the digest of a string literal, without its terminating null character, in a
+             * constant expression.
+             * @ingroup hashes
+             */
+            template<typename Hash, std::size_t N>
+            constexpr typename Hash::digest_type static_hash(const char (&literal)[N]) {
+                return static_hash<Hash>(literal, N - 1);
+            }
+
+            /*!
+             * @ingroup hashes
+             */
+            template<typename Hash>
+            constexpr typename Hash::digest_type static_hash(std::string_view data) {
+                return static_hash<Hash>(data.data(), data.size());
+            }
+        }    // namespace hashes
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_STATIC_HASH_HPP
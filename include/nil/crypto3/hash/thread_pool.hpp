@@ -0,0 +1,187 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_THREAD_POOL_HPP
+#define CRYPTO3_HASH_THREAD_POOL_HPP
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            /*!
+             * @brief Executor running every task on the calling thread.
+             *
+             * An executor provides concurrency(), the number of tasks it may run at once, and
+             * parallel_for(n, f), which calls f(i) for every i in [0, n) and returns once all calls returned.
+             */
+            struct sequential_executor {
+                std::size_t concurrency() const {
+                    return 1;
+                }
+
+                template<typename Function>
+                void parallel_for(std::size_t n, Function f) {
+                    for (std::size_t i = 0; i != n; ++i) {
+                        f(i);
+                    }
+                }
+            };
+
+            /*!
+             * @brief Fixed-size pool of worker threads satisfying the executor interface of
+             * sequential_executor. The thread calling parallel_for takes part in the work, so a pool of
+             * N threads starts N - 1 workers. Calls to parallel_for are serialized; a task must not call
+             * parallel_for on the pool running it.
+             *
+             * If a task throws, tasks not started yet are skipped and parallel_for rethrows the first exception
+             * once all started tasks have returned.
+             */
+            class thread_pool {
+            public:
+                explicit thread_pool(std::size_t threads = std::thread::hardware_concurrency()) :
+                    tasks(0), next(0), done(0), stop(false) {
+                    for (std::size_t i = 1; i < threads; ++i) {
+                        workers.emplace_back([this]() { work(); });
+                    }
+                }
+
+                thread_pool(const thread_pool &) = delete;
+                thread_pool &operator=(const thread_pool &) = delete;
+
+                ~thread_pool() {
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        stop = true;
+                    }
+                    wake.notify_all();
+                    for (std::thread &t : workers) {
+                        t.join();
+                    }
+                }
+
+                /*!
+                 * @brief Process-wide pool with one thread per hardware thread.
+                 */
+                static thread_pool &shared() {
+                    static thread_pool pool;
+                    return pool;
+                }
+
+                std::size_t concurrency() const {
+                    return workers.size() + 1;
+                }
+
+                template<typename Function>
+                void parallel_for(std::size_t n, Function f) {
+                    if (workers.empty() || n <= 1) {
+                        sequential_executor().parallel_for(n, f);
+                        return;
+                    }
+
+                    std::lock_guard<std::mutex> serial(run_mutex);
+                    std::unique_lock<std::mutex> lock(mutex);
+
+                    task = std::ref(f);
+                    tasks = n;
+                    next = 0;
+                    done = 0;
+                    wake.notify_all();
+
+                    drain(lock);
+                    finished.wait(lock, [this]() { return done == tasks; });
+
+                    std::exception_ptr e = error;
+                    error = nullptr;
+                    task = nullptr;
+                    tasks = 0;
+                    if (e) {
+                        std::rethrow_exception(e);
+                    }
+                }
+
+            protected:
+                // Tasks are claimed under the mutex, so a worker never picks up an index of a batch whose
+                // function has already gone out of scope. A throwing task still counts as done, so that
+                // parallel_for does not return while other threads are inside the function.
+                void drain(std::unique_lock<std::mutex> &lock) {
+                    while (next < tasks) {
+                        std::size_t i = next++;
+                        std::exception_ptr e;
+                        lock.unlock();
+                        try {
+                            task(i);
+                        } catch (...) {
+                            e = std::current_exception();
+                        }
+                        lock.lock();
+                        if (e) {
+                            if (!error) {
+                                error = e;
+                            }
+                            // Skip the tasks nobody has claimed yet
+                            done += tasks - next;
+                            next = tasks;
+                        }
+                        if (++done == tasks) {
+                            finished.notify_all();
+                        }
+                    }
+                }
+
+                void work() {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    while (true) {
+                        wake.wait(lock, [this]() { return stop || next < tasks; });
+                        if (stop) {
+                            return;
+                        }
+                        drain(lock);
+                    }
+                }
+
+                std::vector<std::thread> workers;
+
+                std::mutex run_mutex;
+                std::mutex mutex;
+                std::condition_variable wake;
+                std::condition_variable finished;
+
+                std::function<void(std::size_t)> task;
+                std::exception_ptr error;
+                std::size_t tasks;
+                std::size_t next;
+                std::size_t done;
+                bool stop;
+            };
+        }    // namespace hashes
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_THREAD_POOL_HPP
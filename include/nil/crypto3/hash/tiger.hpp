@@ -74,6 +74,17 @@ namespace nil {
                     state[1] = B - state[1];
                     state[2] += C;
                 }
+
+                /*!
+                 * @brief Processes n consecutive blocks of block_words words each.
+                 */
+                static inline void process_blocks(state_type &state, const word_type *blocks, std::size_t n) {
+                    block_type block;
+                    for (; n; --n, blocks += block_words) {
+                        std::copy(blocks, blocks + block_words, block.begin());
+                        process_block(state, block);
+                    }
+                }
             };
 
             /*!
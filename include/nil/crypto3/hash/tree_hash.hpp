@@ -0,0 +1,168 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_TREE_HASH_HPP
+#define CRYPTO3_HASH_TREE_HASH_HPP
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include <boost/static_assert.hpp>
+
+#include <nil/crypto3/detail/octet.hpp>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/thread_pool.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            /*!
+             * @brief Merkle tree hashing mode. The input is split into ChunkOctets-sized chunks (the last one
+             * may be shorter, an empty input is a single empty chunk). Every chunk is hashed as a leaf,
+             * H(0x00 || chunk); then groups of up to Arity consecutive digests are combined into parent nodes,
+             * H(0x01 || d_0 || ... || d_k), level by level until one digest remains. A group holding a single
+             * digest is carried up to the next level unchanged. The leaf and node prefixes keep a leaf from
+             * ever being taken for an inner node.
+             *
+             * Leaves are hashed concurrently by an executor (see hashes::sequential_executor). The tree shape
+             * only depends on the input length, ChunkOctets and Arity, so the root digest is the same for any
+             * number of threads.
+             *
+             * @tparam Hash
+             * @tparam ChunkOctets
+             * @tparam Arity
+             */
+            template<typename Hash, std::size_t ChunkOctets = 64 * 1024, std::size_t Arity = 2>
+            struct tree_hash {
+                BOOST_STATIC_ASSERT(ChunkOctets > 0);
+                BOOST_STATIC_ASSERT(Arity >= 2);
+
+                typedef Hash hash_type;
+                typedef typename hash_type::digest_type digest_type;
+
+                constexpr static const std::size_t chunk_octets = ChunkOctets;
+                constexpr static const std::size_t arity = Arity;
+
+                constexpr static const octet_type leaf_prefix = 0x00;
+                constexpr static const octet_type node_prefix = 0x01;
+
+                static digest_type leaf(const octet_type *first, std::size_t n) {
+                    // The prefix is sent along with the head of the chunk in one block, so the rest of the
+                    // chunk reaches the accumulator block-aligned and is packed straight from memory.
+                    constexpr static const std::size_t block_octets = hash_type::block_bits / octet_bits;
+
+                    std::array<octet_type, block_octets> head;
+                    const std::size_t head_octets = std::min(n, block_octets - 1);
+                    head[0] = leaf_prefix;
+                    std::copy(first, first + head_octets, head.begin() + 1);
+
+                    accumulator_set<hash_type> acc;
+                    hash<hash_type>(head.begin(), head.begin() + head_octets + 1, acc);
+                    hash<hash_type>(first + head_octets, first + n, acc);
+                    return accumulators::extract::hash<hash_type>(acc);
+                }
+
+                static digest_type node(const digest_type *children, std::size_t n) {
+                    std::vector<octet_type> m(1, node_prefix);
+                    for (std::size_t i = 0; i != n; ++i) {
+                        m.insert(m.end(), children[i].begin(), children[i].end());
+                    }
+                    return hash<hash_type>(m);
+                }
+
+                /*!
+                 * @brief Computes the root digest of n octets starting at first.
+                 */
+                template<typename Executor>
+                static digest_type process(const octet_type *first, std::size_t n, Executor &executor) {
+                    // A few runs of leaves per thread even out scheduling noise without paying for a task per
+                    // chunk.
+                    constexpr static const std::size_t tasks_per_thread = 4;
+
+                    const std::size_t leaves = std::max<std::size_t>(1, (n + chunk_octets - 1) / chunk_octets);
+                    const std::size_t tasks = std::min(leaves, executor.concurrency() * tasks_per_thread);
+                    const std::size_t leaves_per_task = (leaves + tasks - 1) / tasks;
+
+                    std::vector<digest_type> level(leaves);
+                    executor.parallel_for((leaves + leaves_per_task - 1) / leaves_per_task, [&](std::size_t task) {
+                        const std::size_t last = std::min(leaves, (task + 1) * leaves_per_task);
+                        for (std::size_t i = task * leaves_per_task; i != last; ++i) {
+                            const std::size_t offset = i * chunk_octets;
+                            level[i] = leaf(first + offset, std::min(chunk_octets, n - offset));
+                        }
+                    });
+
+                    // Inner levels hash arity digests per chunk_octets of input at most, they are left to the
+                    // calling thread.
+                    while (level.size() > 1) {
+                        std::vector<digest_type> parents((level.size() + arity - 1) / arity);
+                        for (std::size_t i = 0; i != parents.size(); ++i) {
+                            const std::size_t children = std::min(arity, level.size() - i * arity);
+                            parents[i] = children == 1 ? level[i * arity] : node(&level[i * arity], children);
+                        }
+                        level.swap(parents);
+                    }
+
+                    return level.front();
+                }
+
+                /*!
+                 * @brief Computes the root digest of n octets starting at first on the process-wide
+                 * hashes::thread_pool::shared() pool.
+                 */
+                static digest_type process(const octet_type *first, std::size_t n) {
+                    return process(first, n, thread_pool::shared());
+                }
+
+                /*!
+                 * @brief Computes the root digest of a contiguous range of octets, e.g. a std::vector<uint8_t>
+                 * or a std::string.
+                 */
+                template<typename ContiguousRange, typename Executor>
+                static typename std::enable_if<!std::is_integral<Executor>::value, digest_type>::type
+                    process(const ContiguousRange &r, Executor &executor) {
+                    BOOST_STATIC_ASSERT(sizeof(*std::data(r)) == sizeof(octet_type));
+                    return process(reinterpret_cast<const octet_type *>(std::data(r)), std::size(r), executor);
+                }
+
+                template<typename ContiguousRange>
+                static digest_type process(const ContiguousRange &r) {
+                    return process(r, thread_pool::shared());
+                }
+            };
+
+            template<typename Hash, std::size_t ChunkOctets, std::size_t Arity>
+            constexpr octet_type const tree_hash<Hash, ChunkOctets, Arity>::leaf_prefix;
+
+            template<typename Hash, std::size_t ChunkOctets, std::size_t Arity>
+            constexpr octet_type const tree_hash<Hash, ChunkOctets, Arity>::node_prefix;
+        }    // namespace hashes
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_TREE_HASH_HPP
@@ -27,6 +27,7 @@
 #define BOOST_TEST_MODULE blake2b_test
 
 #include <iostream>
+#include <vector>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
@@ -296,6 +297,36 @@ BOOST_AUTO_TEST_CASE(blake2b_longmsg_byte1) {
     BOOST_CHECK_EQUAL("3d6c866ebaa149e0c6ad8ba5e9a685e1ad56d81a00fb99d9020f11c0", std::to_string(d).data());
 }
 
+BOOST_AUTO_TEST_CASE(blake2b_512_longmsg_contiguous) {
+    // One million repetitions of "a"
+    std::vector<std::uint8_t> a(1000000, 0x61);
+    hashes::blake2b<512>::digest_type d = hash<hashes::blake2b<512>>(a);
+
+    BOOST_CHECK_EQUAL(
+        "98fb3efb7206fd19ebf69b6f312cf7b64e3b94dbe1a17107913975a793f177e1"
+        "d077609d7fba363cbba00d05f7aa4e4fa8715d6428104c0a75643b0ff3fd3eaf",
+        std::to_string(d).data());
+}
+
+BOOST_AUTO_TEST_CASE(blake2b_256_full_block) {
+    // 128 repetitions of "a": the last block is full and must be compressed exactly once, as the final one
+    std::vector<std::uint8_t> a(128, 0x61);
+    hashes::blake2b<256>::digest_type d = hash<hashes::blake2b<256>>(a);
+
+    BOOST_CHECK_EQUAL("ae2aa48507885c4c950fb809b2076f959cde9f8ea6da260d9a3587df33dac450", std::to_string(d).data());
+}
+
+BOOST_AUTO_TEST_CASE(blake2b_512_full_blocks) {
+    // 256 repetitions of "a"
+    std::vector<std::uint8_t> a(256, 0x61);
+    hashes::blake2b<512>::digest_type d = hash<hashes::blake2b<512>>(a);
+
+    BOOST_CHECK_EQUAL(
+        "0eee13d0c73a2710c5015a8b4be0a16120bb88f826b662951ffe4b3b81441cfd"
+        "ce1f712c58e237dba72a0dad7f9c86b9745ea0b4b3b850ff3a260fb7df9d3e81",
+        std::to_string(d).data());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE(blake2b_accumulator_test_suite)
@@ -0,0 +1,317 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE digest_index_test
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+
+#include <unistd.h>
+
+#include <boost/mpl/list.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/hash/digest_index.hpp>
+
+using namespace nil::crypto3;
+
+typedef boost::mpl::list<std::integral_constant<std::size_t, 32>, std::integral_constant<std::size_t, 160>,
+                         std::integral_constant<std::size_t, 256>, std::integral_constant<std::size_t, 512>>
+    digest_sizes;
+
+template<std::size_t DigestBits>
+static_digest<DigestBits> make_digest(std::uint32_t seed) {
+    static_digest<DigestBits> d;
+    for (octet_type &o : d) {
+        seed = seed * 1103515245 + 12345;
+        o = static_cast<octet_type>(seed >> 16);
+    }
+    return d;
+}
+
+struct temporary_path {
+    temporary_path() {
+        char name[] = "/tmp/crypto3_digest_index_XXXXXX";
+        int fd = ::mkstemp(name);
+        BOOST_REQUIRE(fd >= 0);
+        ::close(fd);
+        path = name;
+        std::remove(path.c_str());
+    }
+
+    ~temporary_path() {
+        std::remove(path.c_str());
+        std::remove((path + ".tmp").c_str());
+    }
+
+    std::string path;
+};
+
+BOOST_AUTO_TEST_SUITE(digest_index_test_suite)
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(digest_set_matches_std_set, DigestBits, digest_sizes) {
+    typedef static_digest<DigestBits::value> digest_type;
+
+    hashes::digest_set<DigestBits::value> s;
+    std::set<digest_type> expected;
+    BOOST_CHECK(s.empty());
+
+    // Inserts, repeated inserts and erases with tombstones left behind along the way
+    std::uint32_t seed = 1;
+    for (std::size_t i = 0; i != 20000; ++i) {
+        seed = seed * 1664525 + 1013904223;
+        const digest_type d = make_digest<DigestBits::value>(seed % 5000);
+        if (seed >> 30) {
+            BOOST_CHECK_EQUAL(s.insert(d), expected.insert(d).second);
+        } else {
+            BOOST_CHECK_EQUAL(s.erase(d), expected.erase(d) != 0);
+        }
+    }
+
+    BOOST_CHECK_EQUAL(s.size(), expected.size());
+    for (std::uint32_t i = 0; i != 5000; ++i) {
+        const digest_type d = make_digest<DigestBits::value>(i);
+        BOOST_CHECK_EQUAL(s.contains(d), expected.count(d) != 0);
+    }
+
+    std::set<digest_type> visited;
+    s.for_each([&](const digest_type &d) { BOOST_CHECK(visited.insert(d).second); });
+    BOOST_CHECK(visited == expected);
+
+    s.clear();
+    BOOST_CHECK(s.empty());
+    BOOST_CHECK(!s.contains(*expected.begin()));
+}
+
+BOOST_AUTO_TEST_CASE(digest_set_colliding_prefixes) {
+    // Equal leading 64 bits put every digest into the same group with the same control octet, so lookups
+    // walk the probe sequence across many groups
+    hashes::digest_set<256> s;
+    std::vector<static_digest<256>> digests;
+    for (std::uint32_t i = 0; i != 300; ++i) {
+        static_digest<256> d = make_digest<256>(i);
+        std::fill(d.begin(), d.begin() + 8, 0x5A);
+        digests.push_back(d);
+        BOOST_CHECK(s.insert(d));
+    }
+    for (std::size_t i = 0; i != digests.size(); i += 2) {
+        BOOST_CHECK(s.erase(digests[i]));
+    }
+    for (std::size_t i = 0; i != digests.size(); ++i) {
+        BOOST_CHECK_EQUAL(s.contains(digests[i]), i % 2 == 1);
+        BOOST_CHECK_EQUAL(s.insert(digests[i]), i % 2 == 0);
+    }
+    BOOST_CHECK_EQUAL(s.size(), digests.size());
+}
+
+BOOST_AUTO_TEST_CASE(digest_set_reserve_and_churn) {
+    hashes::digest_set<256> s(10000);
+    const std::size_t capacity = s.capacity();
+    BOOST_CHECK_GE(capacity * 7 / 8, 10000);
+    BOOST_CHECK_EQUAL(capacity & (capacity - 1), 0);
+
+    for (std::uint32_t i = 0; i != 10000; ++i) {
+        s.insert(make_digest<256>(i));
+    }
+    BOOST_CHECK_EQUAL(s.capacity(), capacity);
+
+    // A sliding window of live digests: tombstones are reclaimed without growing
+    for (std::uint32_t i = 10000; i != 200000; ++i) {
+        BOOST_CHECK(s.erase(make_digest<256>(i - 10000)));
+        BOOST_CHECK(s.insert(make_digest<256>(i)));
+    }
+    BOOST_CHECK_EQUAL(s.size(), 10000);
+    BOOST_CHECK_EQUAL(s.capacity(), capacity);
+    BOOST_CHECK(s.contains(make_digest<256>(199999)));
+    BOOST_CHECK(!s.contains(make_digest<256>(189999)));
+}
+
+BOOST_AUTO_TEST_CASE(digest_map_values) {
+    struct location {
+        std::uint64_t offset;
+        std::uint32_t size;
+    };
+
+    hashes::digest_map<256, location> m;
+    for (std::uint32_t i = 0; i != 5000; ++i) {
+        std::pair<location *, bool> r = m.insert(make_digest<256>(i), location {i * 4096ull, i});
+        BOOST_CHECK(r.second);
+        BOOST_CHECK_EQUAL(r.first->size, i);
+    }
+
+    // An existing entry is kept
+    std::pair<location *, bool> r = m.insert(make_digest<256>(7), location {0, 0});
+    BOOST_CHECK(!r.second);
+    BOOST_CHECK_EQUAL(r.first->offset, 7 * 4096ull);
+    r.first->size = 70;
+
+    const hashes::digest_map<256, location> &c = m;
+    BOOST_REQUIRE(c.find(make_digest<256>(7)));
+    BOOST_CHECK_EQUAL(c.find(make_digest<256>(7))->size, 70);
+    BOOST_CHECK(!c.find(make_digest<256>(5000)));
+
+    BOOST_CHECK(m.erase(make_digest<256>(7)));
+    BOOST_CHECK(!m.find(make_digest<256>(7)));
+
+    std::size_t count = 0;
+    m.for_each([&](const static_digest<256> &d, const location &l) {
+        BOOST_CHECK(d == make_digest<256>(l.size));
+        BOOST_CHECK_EQUAL(l.offset, l.size * 4096ull);
+        ++count;
+    });
+    BOOST_CHECK_EQUAL(count, 4999);
+}
+
+BOOST_AUTO_TEST_CASE(digest_set_move) {
+    hashes::digest_set<256> a;
+    for (std::uint32_t i = 0; i != 100; ++i) {
+        a.insert(make_digest<256>(i));
+    }
+
+    // The moved from set is empty and usable
+    hashes::digest_set<256> b(std::move(a));
+    BOOST_CHECK_EQUAL(b.size(), 100);
+    BOOST_CHECK(b.contains(make_digest<256>(99)));
+    BOOST_CHECK(a.empty());
+    BOOST_CHECK(!a.contains(make_digest<256>(99)));
+    BOOST_CHECK(a.insert(make_digest<256>(1000)));
+
+    hashes::digest_set<256> c;
+    c.insert(make_digest<256>(2000));
+    c = std::move(b);
+    BOOST_CHECK_EQUAL(c.size(), 100);
+    BOOST_CHECK(!c.contains(make_digest<256>(2000)));
+    BOOST_CHECK(b.empty());
+    BOOST_CHECK(b.insert(make_digest<256>(3000)));
+}
+
+BOOST_AUTO_TEST_CASE(digest_map_move_file_backed) {
+    temporary_path file;
+    hashes::digest_map<160, std::uint64_t> a;
+    BOOST_REQUIRE(a.open(file.path));
+    a.insert(make_digest<160>(1), 7);
+
+    // The mapping moves along, the moved from map falls back to memory
+    hashes::digest_map<160, std::uint64_t> b(std::move(a));
+    BOOST_REQUIRE(b.find(make_digest<160>(1)));
+    BOOST_CHECK_EQUAL(*b.find(make_digest<160>(1)), 7);
+    BOOST_CHECK_EQUAL(a.size(), 0);
+    a.insert(make_digest<160>(2), 9);
+    BOOST_CHECK(b.sync());
+
+    hashes::digest_map<160, std::uint64_t> m;
+    BOOST_REQUIRE(m.open(file.path));
+    BOOST_CHECK_EQUAL(m.size(), 1);
+    BOOST_CHECK(!m.find(make_digest<160>(2)));
+}
+
+BOOST_AUTO_TEST_CASE(digest_set_file_persists) {
+    temporary_path file;
+    {
+        hashes::digest_set<256> s;
+        BOOST_REQUIRE(s.open(file.path, 100));
+        // Grows several times while file backed
+        for (std::uint32_t i = 0; i != 20000; ++i) {
+            s.insert(make_digest<256>(i));
+        }
+        BOOST_CHECK(s.erase(make_digest<256>(3)));
+        BOOST_CHECK(s.sync());
+    }
+    BOOST_CHECK(::access((file.path + ".tmp").c_str(), F_OK) != 0);
+
+    {
+        hashes::digest_set<256> s;
+        BOOST_REQUIRE(s.open(file.path));
+        BOOST_CHECK_EQUAL(s.size(), 19999);
+        BOOST_CHECK(!s.contains(make_digest<256>(3)));
+        BOOST_CHECK(s.contains(make_digest<256>(19999)));
+        s.insert(make_digest<256>(3));
+    }
+
+    // Unmapping without sync keeps the changes too, they are in the shared mapping
+    hashes::digest_set<256> s;
+    BOOST_REQUIRE(s.open(file.path));
+    BOOST_CHECK_EQUAL(s.size(), 20000);
+    BOOST_CHECK(s.contains(make_digest<256>(3)));
+}
+
+BOOST_AUTO_TEST_CASE(digest_map_file_persists) {
+    temporary_path file;
+    {
+        hashes::digest_map<160, std::uint64_t> m;
+        BOOST_REQUIRE(m.open(file.path));
+        for (std::uint32_t i = 0; i != 1000; ++i) {
+            m.insert(make_digest<160>(i), i * 3ull);
+        }
+    }
+
+    hashes::digest_map<160, std::uint64_t> m;
+    BOOST_REQUIRE(m.open(file.path));
+    BOOST_CHECK_EQUAL(m.size(), 1000);
+    for (std::uint32_t i = 0; i != 1000; ++i) {
+        BOOST_REQUIRE(m.find(make_digest<160>(i)));
+        BOOST_CHECK_EQUAL(*m.find(make_digest<160>(i)), i * 3ull);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(digest_set_file_rejects_other_content) {
+    temporary_path file;
+    {
+        hashes::digest_set<256> s;
+        BOOST_REQUIRE(s.open(file.path));
+        s.insert(make_digest<256>(1));
+    }
+
+    // Another digest size or slot layout
+    hashes::digest_set<512> other_size;
+    BOOST_CHECK(!other_size.open(file.path));
+    hashes::digest_map<256, std::uint32_t> other_slot;
+    BOOST_CHECK(!other_slot.open(file.path));
+
+    // Not a table: the file is left alone and the set unchanged
+    std::ofstream(file.path) << "not a digest table";
+    hashes::digest_set<256> s;
+    s.insert(make_digest<256>(2));
+    BOOST_CHECK(!s.open(file.path));
+    BOOST_CHECK(s.contains(make_digest<256>(2)));
+    std::string content;
+    std::getline(std::ifstream(file.path), content);
+    BOOST_CHECK_EQUAL(content, "not a digest table");
+
+    BOOST_CHECK(!s.open("/nonexistent/crypto3_digest_index"));
+
+    // Not a regular file, whatever errno was left behind before
+    errno = ENOENT;
+    BOOST_CHECK(!s.open("/dev/null"));
+    BOOST_CHECK(s.contains(make_digest<256>(2)));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
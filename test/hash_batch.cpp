@@ -0,0 +1,138 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE hash_batch_test
+
+#include <atomic>
+#include <list>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/mpl/list.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/algorithm/hash_batch.hpp>
+
+#include <nil/crypto3/hash/blake2b.hpp>
+#include <nil/crypto3/hash/sha2.hpp>
+#include <nil/crypto3/hash/sha3.hpp>
+
+using namespace nil::crypto3;
+
+typedef boost::mpl::list<hashes::sha2<256>, hashes::sha2<224>, hashes::sha2<512>, hashes::sha3<256>,
+                         hashes::blake2b<512>>
+    hash_types;
+
+template<typename Message>
+std::vector<Message> make_messages(std::size_t count) {
+    std::vector<Message> messages;
+    for (std::size_t i = 0; i != count; ++i) {
+        Message m;
+        for (std::size_t j = 0; j != (i * 29) % 250; ++j) {
+            m.push_back(static_cast<char>(i + j * 3));
+        }
+        messages.push_back(m);
+    }
+    return messages;
+}
+
+template<typename Hash, typename Messages, typename Executor>
+void check_batch(const Messages &messages, Executor &executor) {
+    std::vector<typename Hash::digest_type> digests(messages.size());
+    auto end = hash_batch<Hash>(messages, digests.begin(), executor);
+    BOOST_CHECK(end == digests.end());
+
+    for (std::size_t i = 0; i != messages.size(); ++i) {
+        typename Hash::digest_type expected = hash<Hash>(messages[i]);
+        BOOST_CHECK_EQUAL(std::to_string(expected), std::to_string(digests[i]));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(hash_batch_test_suite)
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(hash_batch_sequential, Hash, hash_types) {
+    hashes::sequential_executor executor;
+    check_batch<Hash>(make_messages<std::string>(300), executor);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(hash_batch_thread_pool, Hash, hash_types) {
+    hashes::thread_pool pool(4);
+    BOOST_CHECK_EQUAL(pool.concurrency(), 4);
+
+    check_batch<Hash>(make_messages<std::string>(1000), pool);
+    check_batch<Hash>(make_messages<std::vector<std::uint8_t>>(333), pool);
+    check_batch<Hash>(make_messages<std::string>(1), pool);
+}
+
+BOOST_AUTO_TEST_CASE(hash_batch_non_contiguous_messages) {
+    hashes::thread_pool pool(3);
+    check_batch<hashes::sha2<256>>(make_messages<std::list<std::uint8_t>>(200), pool);
+}
+
+BOOST_AUTO_TEST_CASE(thread_pool_rethrows_task_exception) {
+    hashes::thread_pool pool(4);
+
+    for (std::size_t failing : {0, 1, 57, 99}) {
+        std::atomic<std::size_t> calls(0);
+        BOOST_CHECK_THROW(pool.parallel_for(100,
+                                            [&](std::size_t i) {
+                                                ++calls;
+                                                if (i == failing) {
+                                                    throw std::runtime_error("task failed");
+                                                }
+                                            }),
+                          std::runtime_error);
+        BOOST_CHECK(calls <= 100);
+    }
+
+    // The pool stays usable after a failed batch
+    std::vector<std::atomic<int>> seen(100);
+    pool.parallel_for(seen.size(), [&](std::size_t i) { ++seen[i]; });
+    for (const std::atomic<int> &s : seen) {
+        BOOST_CHECK_EQUAL(s, 1);
+    }
+    check_batch<hashes::sha2<256>>(make_messages<std::string>(100), pool);
+}
+
+BOOST_AUTO_TEST_CASE(hash_batch_empty) {
+    std::vector<std::string> messages;
+    std::vector<hashes::sha2<256>::digest_type> digests;
+    BOOST_CHECK(hash_batch<hashes::sha2<256>>(messages, digests.begin()) == digests.end());
+}
+
+BOOST_AUTO_TEST_CASE(hash_batch_shared_pool) {
+    std::vector<std::string> messages = make_messages<std::string>(500);
+    std::vector<hashes::sha3<256>::digest_type> digests(messages.size());
+    hash_batch<hashes::sha3<256>>(messages, digests.data());
+
+    for (std::size_t i = 0; i != messages.size(); ++i) {
+        hashes::sha3<256>::digest_type expected = hash<hashes::sha3<256>>(messages[i]);
+        BOOST_CHECK_EQUAL(std::to_string(expected), std::to_string(digests[i]));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
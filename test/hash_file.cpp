@@ -0,0 +1,129 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE hash_file_test
+
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#include <boost/mpl/list.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/algorithm/hash_file.hpp>
+
+#include <nil/crypto3/hash/blake2b.hpp>
+#include <nil/crypto3/hash/sha2.hpp>
+#include <nil/crypto3/hash/sha3.hpp>
+
+#include "test_input.hpp"
+
+using namespace nil::crypto3;
+
+typedef boost::mpl::list<hashes::sha2<256>, hashes::sha3<256>, hashes::blake2b<512>> hash_types;
+
+struct temporary_file {
+    explicit temporary_file(const std::vector<octet_type> &content) {
+        char name[] = "/tmp/crypto3_hash_file_XXXXXX";
+        int fd = ::mkstemp(name);
+        BOOST_REQUIRE(fd >= 0);
+        BOOST_REQUIRE(::write(fd, content.data(), content.size()) == static_cast<ssize_t>(content.size()));
+        ::close(fd);
+        path = name;
+    }
+
+    ~temporary_file() {
+        std::remove(path.c_str());
+    }
+
+    std::string path;
+};
+
+BOOST_AUTO_TEST_SUITE(hash_file_test_suite)
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(hash_file_regular, Hash, hash_types) {
+    for (std::size_t size : {0, 1, 200, 4096, (1 << 20) + 17}) {
+        std::vector<octet_type> content = make_input(size);
+        temporary_file file(content);
+        std::string expected = std::to_string(typename Hash::digest_type(hash<Hash>(content)));
+
+        hashes::file_options mapped;
+        hashes::file_options huge;
+        huge.huge_pages = true;
+        hashes::file_options read;
+        read.mmap = false;
+        hashes::file_options small_buffer;
+        small_buffer.mmap = false;
+        small_buffer.buffer_octets = 100;
+
+        for (const hashes::file_options &options : {mapped, huge, read, small_buffer}) {
+            typename Hash::digest_type d;
+            BOOST_REQUIRE(hash_file<Hash>(file.path, d, options));
+            BOOST_CHECK_EQUAL(expected, std::to_string(d));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hash_file_pipe) {
+    std::vector<octet_type> content = make_input(300000);
+
+    int fds[2];
+    BOOST_REQUIRE(::pipe(fds) == 0);
+    std::thread writer([&]() {
+        const octet_type *p = content.data();
+        std::size_t n = content.size();
+        while (n) {
+            ssize_t r = ::write(fds[1], p, std::min<std::size_t>(n, 7000));
+            if (r <= 0) {
+                break;
+            }
+            p += r;
+            n -= r;
+        }
+        ::close(fds[1]);
+    });
+
+    accumulator_set<hashes::sha2<256>> acc;
+    bool result = hash_file<hashes::sha2<256>>(fds[0], acc);
+    writer.join();
+    ::close(fds[0]);
+
+    BOOST_REQUIRE(result);
+    hashes::sha2<256>::digest_type expected = hash<hashes::sha2<256>>(content);
+    BOOST_CHECK_EQUAL(std::to_string(expected), std::to_string(accumulators::extract::hash<hashes::sha2<256>>(acc)));
+}
+
+BOOST_AUTO_TEST_CASE(hash_file_missing) {
+    hashes::sha2<256>::digest_type d;
+    d.fill(0x5a);
+    BOOST_CHECK(!hash_file<hashes::sha2<256>>("/nonexistent/crypto3/hash_file", d));
+    BOOST_CHECK_EQUAL(d[0], 0x5a);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,156 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE hash_pair_test
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <boost/mpl/list.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/hash_pair.hpp>
+
+#include <nil/crypto3/hash/sha2.hpp>
+#include <nil/crypto3/hash/keccak.hpp>
+#include <nil/crypto3/hash/sha3.hpp>
+#include <nil/crypto3/hash/blake2b.hpp>
+
+#include "test_input.hpp"
+
+using namespace nil::crypto3;
+
+template<typename Hash>
+std::vector<typename Hash::digest_type> make_children(std::size_t count) {
+    std::vector<typename Hash::digest_type> children(count);
+    for (std::size_t i = 0; i != count; ++i) {
+        std::vector<octet_type> m = make_input(children[i].size(), i);
+        std::copy(m.begin(), m.end(), children[i].begin());
+    }
+    return children;
+}
+
+template<typename Hash>
+std::string expected_pair(const typename Hash::digest_type &lhs, const typename Hash::digest_type &rhs) {
+    std::vector<octet_type> m(lhs.begin(), lhs.end());
+    m.insert(m.end(), rhs.begin(), rhs.end());
+    typename Hash::digest_type d = hash<Hash>(m);
+    return std::to_string(d);
+}
+
+template<typename Kernel>
+void check_kernel(std::size_t count) {
+    typedef hashes::sha2<256> hash_type;
+
+    if (!Kernel::supported()) {
+        BOOST_TEST_MESSAGE("kernel is not supported by this CPU, skipping");
+        return;
+    }
+
+    std::vector<hash_type::digest_type> children = make_children<hash_type>(2 * count), parents(count);
+    hashes::detail::hash_pair_impl<hash_type>::template process<Kernel>(children.data(), count, parents.data());
+
+    for (std::size_t i = 0; i != count; ++i) {
+        BOOST_CHECK_EQUAL(expected_pair<hash_type>(children[2 * i], children[2 * i + 1]), std::to_string(parents[i]));
+    }
+}
+
+typedef boost::mpl::list<hashes::sha2<256>, hashes::keccak_1600<256>, hashes::sha3<256>, hashes::blake2b<256>,
+                         hashes::sha3<224>, hashes::keccak_1600<384>, hashes::blake2b<512>>
+    hash_types;
+
+BOOST_AUTO_TEST_SUITE(hash_pair_test_suite)
+
+BOOST_AUTO_TEST_CASE(hash_pair_sha2_256_vector) {
+    // Merkle node over the leaves "a" and "b"
+    typedef hashes::sha2<256> hash_type;
+    hash_type::digest_type a = hash<hash_type>(std::string("a")), b = hash<hash_type>(std::string("b"));
+
+    BOOST_CHECK_EQUAL("e5a01fee14e0ed5c48714f22180f25ad8365b53f9779f79dc4a3d7e93963f94a",
+                      std::to_string(hashes::hash_pair<hash_type>(a, b)));
+}
+
+BOOST_AUTO_TEST_CASE(hash_pair_sha3_256_vector) {
+    typedef hashes::sha3<256> hash_type;
+    hash_type::digest_type a = hash<hash_type>(std::string("a")), b = hash<hash_type>(std::string("b"));
+
+    BOOST_CHECK_EQUAL("29df505440ebe180c00857e92b0694c56a33762b08944472492b0cbf6ec607e3",
+                      std::to_string(hashes::hash_pair<hash_type>(a, b)));
+}
+
+BOOST_AUTO_TEST_CASE(hash_pair_blake2b_256_vector) {
+    typedef hashes::blake2b<256> hash_type;
+    hash_type::digest_type a = hash<hash_type>(std::string("a")), b = hash<hash_type>(std::string("b"));
+
+    BOOST_CHECK_EQUAL("43145816c4f1efa1c8bda6dc342028e63cec088c591dfebac0ef70b4825b3c71",
+                      std::to_string(hashes::hash_pair<hash_type>(a, b)));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(hash_pair_matches_hash, Hash, hash_types) {
+    std::vector<typename Hash::digest_type> children = make_children<Hash>(16);
+    for (std::size_t i = 0; i != children.size(); i += 2) {
+        BOOST_CHECK_EQUAL(expected_pair<Hash>(children[i], children[i + 1]),
+                          std::to_string(hashes::hash_pair<Hash>(children[i], children[i + 1])));
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(hash_pairs_level, Hash, hash_types) {
+    // Around the 8 and 16 lane boundaries of the SHA-256 kernels
+    for (std::size_t count : {0, 1, 2, 7, 8, 9, 16, 17, 33}) {
+        std::vector<typename Hash::digest_type> children = make_children<Hash>(2 * count), parents(count);
+        hashes::hash_pairs<Hash>(children.data(), count, parents.data());
+        for (std::size_t i = 0; i != count; ++i) {
+            BOOST_CHECK_EQUAL(expected_pair<Hash>(children[2 * i], children[2 * i + 1]), std::to_string(parents[i]));
+        }
+
+        // In place, as when reducing a tree level by level
+        hashes::hash_pairs<Hash>(children.data(), count, children.data());
+        for (std::size_t i = 0; i != count; ++i) {
+            BOOST_CHECK(children[i] == parents[i]);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hash_pairs_sha2_256_scalar) {
+    check_kernel<hashes::detail::sha2_256_scalar_lanes>(5);
+}
+
+#ifdef CRYPTO3_HAS_X86_INTRINSICS
+BOOST_AUTO_TEST_CASE(hash_pairs_sha2_256_avx2) {
+    check_kernel<hashes::detail::sha2_256_avx2_lanes>(1);
+    check_kernel<hashes::detail::sha2_256_avx2_lanes>(8);
+    check_kernel<hashes::detail::sha2_256_avx2_lanes>(21);
+}
+
+BOOST_AUTO_TEST_CASE(hash_pairs_sha2_256_avx512) {
+    check_kernel<hashes::detail::sha2_256_avx512_lanes>(3);
+    check_kernel<hashes::detail::sha2_256_avx512_lanes>(16);
+    check_kernel<hashes::detail::sha2_256_avx512_lanes>(45);
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
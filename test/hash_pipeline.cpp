@@ -0,0 +1,175 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE hash_pipeline_test
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <unistd.h>
+
+#include <boost/mpl/list.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/hash_pipeline.hpp>
+
+#include <nil/crypto3/hash/blake2b.hpp>
+#include <nil/crypto3/hash/sha2.hpp>
+#include <nil/crypto3/hash/sha3.hpp>
+
+#include "test_input.hpp"
+
+using namespace nil::crypto3;
+
+typedef boost::mpl::list<hashes::sha2<256>, hashes::sha2<512>, hashes::sha3<256>, hashes::blake2b<512>> hash_types;
+
+// The buffer count is not a pipeline
+BOOST_STATIC_ASSERT((!std::is_convertible<std::size_t, hashes::hash_pipeline<hashes::sha2<256>>>::value));
+
+BOOST_AUTO_TEST_SUITE(hash_pipeline_test_suite)
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(hash_pipeline_istream, Hash, hash_types) {
+    // Small buffers to cycle through the ring many times
+    hashes::hash_pipeline<Hash> pipeline(3, 1000);
+
+    for (std::size_t size : {0, 1, 127, 128, 999, 1000, 1024, 100000}) {
+        std::string input = make_input<std::string>(size);
+        std::istringstream in(input);
+
+        typename Hash::digest_type d;
+        BOOST_REQUIRE(pipeline(in, d));
+        BOOST_CHECK_EQUAL(std::to_string(typename Hash::digest_type(hash<Hash>(input))), std::to_string(d));
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(hash_pipeline_source, Hash, hash_types) {
+    hashes::hash_pipeline<Hash> pipeline(2, 256);
+    std::string input = make_input<std::string>(50000);
+
+    // Returns odd-sized pieces, as a decompressor would
+    std::size_t offset = 0;
+    auto source = [&](octet_type *p, std::size_t n) -> std::ptrdiff_t {
+        n = std::min({n, input.size() - offset, std::size_t(77)});
+        std::copy(input.begin() + offset, input.begin() + offset + n, p);
+        offset += n;
+        return n;
+    };
+
+    typename Hash::digest_type d;
+    BOOST_REQUIRE(pipeline(source, d));
+    BOOST_CHECK_EQUAL(std::to_string(typename Hash::digest_type(hash<Hash>(input))), std::to_string(d));
+}
+
+BOOST_AUTO_TEST_CASE(hash_pipeline_source_failure) {
+    hashes::hash_pipeline<hashes::sha2<256>> pipeline(2, 64);
+
+    std::size_t calls = 0;
+    auto source = [&](octet_type *, std::size_t n) -> std::ptrdiff_t {
+        return ++calls > 10 ? -1 : static_cast<std::ptrdiff_t>(n);
+    };
+
+    hashes::sha2<256>::digest_type d;
+    d.fill(0x5a);
+    BOOST_CHECK(!pipeline(source, d));
+    BOOST_CHECK_EQUAL(d[0], 0x5a);
+}
+
+BOOST_AUTO_TEST_CASE(hash_pipeline_source_exception) {
+    hashes::hash_pipeline<hashes::sha2<256>> pipeline(2, 64);
+
+    std::size_t calls = 0;
+    auto source = [&](octet_type *, std::size_t n) -> std::ptrdiff_t {
+        if (++calls > 10) {
+            throw std::runtime_error("source failed");
+        }
+        return static_cast<std::ptrdiff_t>(n);
+    };
+
+    hashes::sha2<256>::digest_type d;
+    BOOST_CHECK_THROW(pipeline(source, d), std::runtime_error);
+
+    // The pipeline is reusable after an exception
+    std::string input = make_input<std::string>(1000);
+    std::istringstream in(input);
+    BOOST_REQUIRE(pipeline(in, d));
+    BOOST_CHECK_EQUAL(std::to_string(hashes::sha2<256>::digest_type(hash<hashes::sha2<256>>(input))),
+                      std::to_string(d));
+}
+
+BOOST_AUTO_TEST_CASE(hash_pipeline_pipe) {
+    std::string input = make_input<std::string>(1 << 20);
+
+    int fds[2];
+    BOOST_REQUIRE(::pipe(fds) == 0);
+    std::thread writer([&]() {
+        std::size_t n = 0;
+        while (n != input.size()) {
+            ssize_t r = ::write(fds[1], input.data() + n, std::min<std::size_t>(input.size() - n, 5000));
+            if (r <= 0) {
+                break;
+            }
+            n += r;
+        }
+        ::close(fds[1]);
+    });
+
+    hashes::hash_pipeline<hashes::sha2<256>> pipeline;
+    hashes::sha2<256>::digest_type d;
+    bool result = pipeline(fds[0], d);
+    writer.join();
+    ::close(fds[0]);
+
+    BOOST_REQUIRE(result);
+    BOOST_CHECK_EQUAL(std::to_string(hashes::sha2<256>::digest_type(hash<hashes::sha2<256>>(input))),
+                      std::to_string(d));
+}
+
+BOOST_AUTO_TEST_CASE(hash_pipeline_ifstream) {
+    std::string input = make_input<std::string>(300000);
+    char name[] = "/tmp/crypto3_hash_pipeline_XXXXXX";
+    int fd = ::mkstemp(name);
+    BOOST_REQUIRE(fd >= 0);
+    BOOST_REQUIRE(::write(fd, input.data(), input.size()) == static_cast<ssize_t>(input.size()));
+    ::close(fd);
+
+    std::ifstream in(name, std::ios::binary);
+    hashes::hash_pipeline<hashes::sha3<256>> pipeline(4, 4096);
+    hashes::sha3<256>::digest_type d;
+    BOOST_CHECK(pipeline(in, d));
+    std::remove(name);
+
+    BOOST_CHECK_EQUAL(std::to_string(hashes::sha3<256>::digest_type(hash<hashes::sha3<256>>(input))),
+                      std::to_string(d));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,235 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE hasher_test
+
+#include <iterator>
+#include <list>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/mpl/list.hpp>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/hasher.hpp>
+#include <nil/crypto3/hash/prefix_cache.hpp>
+
+#include <nil/crypto3/hash/blake2b.hpp>
+#include <nil/crypto3/hash/keccak.hpp>
+#include <nil/crypto3/hash/ripemd.hpp>
+#include <nil/crypto3/hash/sha1.hpp>
+#include <nil/crypto3/hash/sha2.hpp>
+#include <nil/crypto3/hash/sha256d.hpp>
+#include <nil/crypto3/hash/sha3.hpp>
+#include <nil/crypto3/hash/tiger.hpp>
+
+#include "test_input.hpp"
+
+using namespace nil::crypto3;
+
+typedef boost::mpl::list<hashes::sha1, hashes::sha2<224>, hashes::sha2<256>, hashes::sha2<384>, hashes::sha2<512>,
+                         hashes::ripemd160, hashes::tiger<192>, hashes::keccak_1600<256>, hashes::sha3<256>,
+                         hashes::sha3<512>, hashes::blake2b<512>>
+    hash_types;
+
+const std::size_t lengths[] = {0, 1, 3, 55, 56, 63, 64, 65, 111, 112, 127, 128, 129, 135, 136, 137, 255, 1000};
+
+template<typename Saved, typename Loaded>
+bool load_saved_as(const std::vector<std::uint8_t> &m) {
+    hashes::hasher<Saved> h;
+    h.update(m);
+
+    std::vector<std::uint8_t> saved;
+    h.save(std::back_inserter(saved));
+
+    hashes::hasher<Loaded> other;
+    return other.load(saved.begin(), saved.end());
+}
+
+BOOST_AUTO_TEST_SUITE(hasher_test_suite)
+
+BOOST_AUTO_TEST_CASE(hasher_sha2_256_abc) {
+    hashes::hasher<hashes::sha2<256>> h;
+    std::string input = "abc";
+
+    BOOST_CHECK_EQUAL("ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad",
+                      std::to_string(h.update(input).finalize()).data());
+    BOOST_CHECK_EQUAL("e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855",
+                      std::to_string(h.finalize()).data());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(hasher_matches_accumulator, Hash, hash_types) {
+    hashes::hasher<Hash> h;
+
+    for (std::size_t length : lengths) {
+        std::vector<std::uint8_t> m = make_input(length);
+        std::string expected = std::to_string(typename Hash::digest_type(hash<Hash>(m)));
+
+        BOOST_CHECK_EQUAL(expected, std::to_string(h.update(m).finalize()));
+
+        for (std::size_t split = 0; split <= length; split += 17) {
+            h.update(m.data(), split);
+            h.update(m.data() + split, length - split);
+            BOOST_CHECK_EQUAL(expected, std::to_string(h.finalize()));
+        }
+
+        std::list<std::uint8_t> l(m.begin(), m.end());
+        BOOST_CHECK_EQUAL(expected, std::to_string(h.update(l.begin(), l.end()).finalize()));
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(hasher_reset, Hash, hash_types) {
+    std::vector<std::uint8_t> m = make_input(300);
+    hashes::hasher<Hash> h;
+
+    std::string expected = std::to_string(h.update(m).finalize());
+
+    h.update(make_input(1000));
+    h.reset();
+    BOOST_CHECK_EQUAL(expected, std::to_string(h.update(m).finalize()));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(hasher_state_test_suite)
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(hasher_save_load, Hash, hash_types) {
+    std::vector<std::uint8_t> m = make_input(1000);
+    hashes::hasher<Hash> h;
+    std::string expected = std::to_string(h.update(m).finalize());
+
+    for (std::size_t split : lengths) {
+        h.update(m.data(), split);
+
+        std::vector<std::uint8_t> saved;
+        h.save(std::back_inserter(saved));
+        BOOST_CHECK_EQUAL(saved.size(), hashes::hasher<Hash>::serialized_octets);
+        h.reset();
+
+        hashes::hasher<Hash> resumed;
+        BOOST_CHECK(resumed.load(saved.begin(), saved.end()));
+        resumed.update(m.data() + split, m.size() - split);
+        BOOST_CHECK_EQUAL(expected, std::to_string(resumed.finalize()));
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(accumulator_save_load, Hash, hash_types) {
+    std::vector<std::uint8_t> m = make_input(1000);
+    std::string expected = std::to_string(typename Hash::digest_type(hash<Hash>(m)));
+
+    for (std::size_t split : lengths) {
+        accumulator_set<Hash> acc;
+        hash<Hash>(m.begin(), m.begin() + split, acc);
+
+        std::vector<std::uint8_t> saved;
+        accumulators::save_state<Hash>(acc, std::back_inserter(saved));
+
+        accumulator_set<Hash> resumed_acc;
+        BOOST_CHECK(accumulators::load_state<Hash>(resumed_acc, saved.begin(), saved.end()));
+        BOOST_CHECK_EQUAL(accumulators::extract::bits_count(resumed_acc), split * 8);
+        hash<Hash>(m.begin() + split, m.end(), resumed_acc);
+        BOOST_CHECK_EQUAL(accumulators::extract::bits_count(resumed_acc), m.size() * 8);
+        BOOST_CHECK_EQUAL(expected, std::to_string(accumulators::extract::hash<Hash>(resumed_acc)));
+
+        hashes::hasher<Hash> resumed_hasher;
+        BOOST_CHECK(resumed_hasher.load(saved.begin(), saved.end()));
+        resumed_hasher.update(m.data() + split, m.size() - split);
+        BOOST_CHECK_EQUAL(expected, std::to_string(resumed_hasher.finalize()));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hasher_load_rejects_foreign_state) {
+    std::vector<std::uint8_t> m = make_input(100);
+    hashes::hasher<hashes::sha2<256>> h;
+    h.update(m);
+
+    std::vector<std::uint8_t> saved;
+    h.save(std::back_inserter(saved));
+
+    BOOST_CHECK_EQUAL(saved[0], 'C');
+    BOOST_CHECK_EQUAL(saved[1], '3');
+    BOOST_CHECK_EQUAL(saved[2], 'H');
+    BOOST_CHECK_EQUAL(saved[3], 'S');
+    BOOST_CHECK_EQUAL(saved[5], 32);
+    BOOST_CHECK_EQUAL(saved[6], 0);
+
+    hashes::hasher<hashes::sha2<224>> other;
+    BOOST_CHECK(!other.load(saved.begin(), saved.end()));
+
+    hashes::hasher<hashes::sha2<256>> truncated;
+    BOOST_CHECK(!truncated.load(saved.begin(), saved.end() - 1));
+
+    saved[4] ^= 0xff;
+    BOOST_CHECK(!truncated.load(saved.begin(), saved.end()));
+    BOOST_CHECK_EQUAL("e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855",
+                      std::to_string(truncated.finalize()).data());
+}
+
+BOOST_AUTO_TEST_CASE(hasher_load_rejects_same_shape_hash) {
+    std::vector<std::uint8_t> m = make_input(100);
+
+    BOOST_CHECK((load_saved_as<hashes::sha2<512>, hashes::sha2<512>>(m)));
+    BOOST_CHECK((!load_saved_as<hashes::sha2<512>, hashes::blake2b<512>>(m)));
+    BOOST_CHECK((!load_saved_as<hashes::blake2b<512>, hashes::sha2<512>>(m)));
+    BOOST_CHECK((!load_saved_as<hashes::keccak_1600<256>, hashes::sha3<256>>(m)));
+    BOOST_CHECK((!load_saved_as<hashes::sha2<256>, hashes::sha256d>(m)));
+    BOOST_CHECK((!load_saved_as<hashes::sha2<256, 512>, hashes::blake2b<256>>(m)));
+
+    accumulator_set<hashes::sha2<512>> acc;
+    hash<hashes::sha2<512>>(m.begin(), m.end(), acc);
+    std::vector<std::uint8_t> saved;
+    accumulators::save_state<hashes::sha2<512>>(acc, std::back_inserter(saved));
+
+    accumulator_set<hashes::blake2b<512>> other;
+    BOOST_CHECK(!accumulators::load_state<hashes::blake2b<512>>(other, saved.begin(), saved.end()));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(prefix_cache_test_suite)
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(prefix_cache_matches_concatenation, Hash, hash_types) {
+    std::vector<std::uint8_t> m = make_input(1300);
+
+    for (std::size_t prefix_length : lengths) {
+        hashes::prefix_cache<Hash> prefix(m.begin(), m.begin() + prefix_length);
+        hashes::hasher<Hash> h;
+
+        for (std::size_t message_length : {0, 1, 64, 200}) {
+            std::vector<std::uint8_t> concatenated(m.begin(), m.begin() + prefix_length + message_length);
+            std::string expected = std::to_string(typename Hash::digest_type(hash<Hash>(concatenated)));
+
+            std::vector<std::uint8_t> message(m.begin() + prefix_length,
+                                              m.begin() + prefix_length + message_length);
+            BOOST_CHECK_EQUAL(expected, std::to_string(prefix(message)));
+
+            prefix.restore(h);
+            BOOST_CHECK_EQUAL(expected, std::to_string(h.update(message).finalize()));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,49 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_TEST_INPUT_HPP
+#define CRYPTO3_HASH_TEST_INPUT_HPP
+
+#include <cstddef>
+#include <vector>
+
+#include <nil/crypto3/detail/octet.hpp>
+
+/*!
+ * @brief Deterministic test input of size octets. The pattern does not repeat with the block size, so blocks
+ * that are hashed in the wrong order or twice change the digest.
+ * @tparam Container std::vector<octet_type>, std::string or any other sequence constructible from a size
+ * @param seed Offsets every octet, so that inputs of the same size told apart by it differ
+ */
+template<typename Container = std::vector<nil::crypto3::octet_type>>
+Container make_input(std::size_t size, std::size_t seed = 0) {
+    Container r(size, 0);
+    for (std::size_t i = 0; i != size; ++i) {
+        r[i] = static_cast<typename Container::value_type>(i * 131 + (i >> 8) + seed);
+    }
+    return r;
+}
+
+#endif    // CRYPTO3_HASH_TEST_INPUT_HPP
@@ -0,0 +1,149 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE hash_instrument_test
+
+#define CRYPTO3_HASH_INSTRUMENT
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/hasher.hpp>
+
+#include <nil/crypto3/hash/blake2b.hpp>
+#include <nil/crypto3/hash/sha2.hpp>
+#include <nil/crypto3/hash/sha3.hpp>
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::hashes::instrument;
+
+template<typename Hash>
+totals_type totals_of() {
+    std::map<std::string, totals_type> t = registry::instance().totals();
+    return t[boost::core::demangle(typeid(Hash).name())];
+}
+
+// Every test case starts from zeroed counters, whatever ran before it
+struct registry_fixture {
+    registry_fixture() {
+        registry::instance().reset();
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE(instrument_test_suite, registry_fixture)
+
+BOOST_AUTO_TEST_CASE(instrument_sha2_256) {
+    // 15 full blocks and 40 octets, the padding and the length fit into the 16th block
+    std::vector<std::uint8_t> input(1000, 0x61);
+    hashes::sha2<256>::digest_type d = hash<hashes::sha2<256>>(input);
+    (void)d;
+
+    totals_type t = totals_of<hashes::sha2<256>>();
+    BOOST_CHECK_EQUAL(t[bits_absorbed], 8000);
+    BOOST_CHECK_EQUAL(t[blocks_packed], 16);
+    BOOST_CHECK_EQUAL(t[blocks_compressed], 16);
+    BOOST_CHECK_EQUAL(t[padding_blocks], 0);
+    BOOST_CHECK_EQUAL(t[finalizations], 1);
+}
+
+BOOST_AUTO_TEST_CASE(instrument_two_padding_blocks) {
+    // 60 octets leave no room for the 64-bit length, padding takes a second block. No other test case hashes
+    // with sha2<224>, so the counters are only reported under its name if the hasher names them itself
+    std::vector<std::uint8_t> input(60, 0x61);
+    hashes::hasher<hashes::sha2<224>> h;
+    h.update(input).finalize();
+
+    totals_type t = totals_of<hashes::sha2<224>>();
+    BOOST_CHECK_EQUAL(t[blocks_compressed], 2);
+    BOOST_CHECK_EQUAL(t[padding_blocks], 1);
+    BOOST_CHECK_EQUAL(t[finalizations], 1);
+}
+
+BOOST_AUTO_TEST_CASE(instrument_threads) {
+    std::vector<std::uint8_t> input(500, 0x62);
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i != 4; ++i) {
+        threads.emplace_back([&]() {
+            for (std::size_t j = 0; j != 10; ++j) {
+                hashes::sha3<256>::digest_type d = hash<hashes::sha3<256>>(input);
+                (void)d;
+            }
+        });
+    }
+    for (std::thread &t : threads) {
+        t.join();
+    }
+
+    // Counters of exited threads are retained
+    totals_type t = totals_of<hashes::sha3<256>>();
+    BOOST_CHECK_EQUAL(t[bits_absorbed], 4 * 10 * 500 * 8);
+    BOOST_CHECK_EQUAL(t[finalizations], 4 * 10);
+    // 500 octets are 3 full 136-octet blocks and a padded fourth
+    BOOST_CHECK_EQUAL(t[blocks_compressed], 4 * 10 * 4);
+    BOOST_CHECK_EQUAL(t[padding_blocks], 0);
+}
+
+BOOST_AUTO_TEST_CASE(instrument_padding_only_blocks) {
+    // A whole number of blocks takes a padding-only block for sha2 and sha3, none for blake2b
+    std::vector<std::uint8_t> input(2 * 136, 0x63);
+    hashes::sha2<256>::digest_type d2 = hash<hashes::sha2<256>>(input.begin(), input.begin() + 128);
+    hashes::sha3<256>::digest_type d3 = hash<hashes::sha3<256>>(input);
+    hashes::blake2b<512>::digest_type db = hash<hashes::blake2b<512>>(input.begin(), input.begin() + 256);
+    (void)d2;
+    (void)d3;
+    (void)db;
+
+    BOOST_CHECK_EQUAL(totals_of<hashes::sha2<256>>()[blocks_compressed], 3);
+    BOOST_CHECK_EQUAL(totals_of<hashes::sha2<256>>()[padding_blocks], 1);
+    BOOST_CHECK_EQUAL(totals_of<hashes::sha3<256>>()[blocks_compressed], 3);
+    BOOST_CHECK_EQUAL(totals_of<hashes::sha3<256>>()[padding_blocks], 1);
+    BOOST_CHECK_EQUAL(totals_of<hashes::blake2b<512>>()[blocks_compressed], 2);
+    BOOST_CHECK_EQUAL(totals_of<hashes::blake2b<512>>()[padding_blocks], 0);
+
+    // The only block of an empty message is all padding
+    registry::instance().reset();
+    db = hash<hashes::blake2b<512>>(input.begin(), input.begin());
+    BOOST_CHECK_EQUAL(totals_of<hashes::blake2b<512>>()[blocks_compressed], 1);
+    BOOST_CHECK_EQUAL(totals_of<hashes::blake2b<512>>()[padding_blocks], 1);
+}
+
+BOOST_AUTO_TEST_CASE(instrument_json) {
+    hashes::blake2b<512>::digest_type d = hash<hashes::blake2b<512>>(std::string("abc"));
+    (void)d;
+
+    std::string json = registry::instance().json();
+    BOOST_CHECK(json.find("\"nil::crypto3::hashes::blake2b<512") != std::string::npos);
+    BOOST_CHECK(json.find("\"octets_absorbed\": 3}") != std::string::npos);
+    BOOST_CHECK(json.find("\"finalizations\": 1") != std::string::npos);
+
+    registry::instance().reset();
+    BOOST_CHECK_EQUAL(totals_of<hashes::blake2b<512>>()[finalizations], 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -26,6 +26,8 @@
 #define BOOST_TEST_MODULE keccak_test
 
 #include <iostream>
+#include <list>
+#include <vector>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
@@ -283,6 +285,22 @@ BOOST_AUTO_TEST_CASE(keccak_512_shortmsg_byte3) {
         std::to_string(d).data());
 }
 
+BOOST_AUTO_TEST_CASE(keccak_256_longmsg_contiguous) {
+    // Contiguous input is packed block by block, other input goes value by value through the cache
+    std::vector<std::uint8_t> a(1000);
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        a[i] = static_cast<std::uint8_t>(i * 7 + 1);
+    }
+    std::list<std::uint8_t> l(a.begin(), a.end());
+
+    for (std::size_t n : {135, 136, 137, 272, 1000}) {
+        std::string contiguous = hash<hashes::keccak_1600<256>>(a.begin(), a.begin() + n);
+        std::string by_value = hash<hashes::keccak_1600<256>>(l.begin(), std::next(l.begin(), n));
+
+        BOOST_CHECK_EQUAL(contiguous, by_value);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE(keccak_accumulator_test_suite)
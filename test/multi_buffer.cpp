@@ -0,0 +1,200 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE multi_buffer_test
+
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/multi_buffer.hpp>
+
+#include <nil/crypto3/hash/sha2.hpp>
+#include <nil/crypto3/hash/sha256d.hpp>
+#include <nil/crypto3/hash/sha3.hpp>
+
+#include "test_input.hpp"
+
+using namespace nil::crypto3;
+
+struct batch {
+    explicit batch(std::size_t count) {
+        for (std::size_t i = 0; i != count; ++i) {
+            // Lengths around the one and two tail block boundaries and some multi-block messages
+            messages.push_back(make_input((i * 37) % 300, i));
+        }
+        for (const std::vector<octet_type> &m : messages) {
+            pointers.push_back(m.data());
+            sizes.push_back(m.size());
+        }
+    }
+
+    template<typename Hash>
+    std::vector<std::string> expected() const {
+        std::vector<std::string> r;
+        for (const std::vector<octet_type> &m : messages) {
+            r.push_back(std::to_string(typename Hash::digest_type(hash<Hash>(m))));
+        }
+        return r;
+    }
+
+    std::vector<std::vector<octet_type>> messages;
+    std::vector<const octet_type *> pointers;
+    std::vector<std::size_t> sizes;
+};
+
+template<std::size_t DigestBits, typename Kernel>
+void check_kernel(std::size_t count) {
+    if (!Kernel::supported()) {
+        BOOST_TEST_MESSAGE("kernel is not supported by this CPU, skipping");
+        return;
+    }
+
+    batch b(count);
+    std::vector<static_digest<DigestBits>> digests(count);
+    hashes::detail::sha2_256_multi_buffer<DigestBits>::template process<Kernel>(b.pointers.data(), b.sizes.data(),
+                                                                               count, digests.data());
+
+    std::vector<std::string> expected = b.template expected<hashes::sha2<DigestBits>>();
+    for (std::size_t i = 0; i != count; ++i) {
+        BOOST_CHECK_EQUAL(expected[i], std::to_string(digests[i]));
+    }
+}
+
+template<typename Kernel>
+void check_sha256d_kernel(std::size_t count) {
+    if (!Kernel::supported()) {
+        BOOST_TEST_MESSAGE("kernel is not supported by this CPU, skipping");
+        return;
+    }
+
+    batch b(count);
+    std::vector<hashes::sha256d::digest_type> digests(count);
+    hashes::detail::sha2_256_multi_buffer<256, 2>::template process<Kernel>(b.pointers.data(), b.sizes.data(), count,
+                                                                           digests.data());
+
+    std::vector<std::string> expected = b.template expected<hashes::sha256d>();
+    for (std::size_t i = 0; i != count; ++i) {
+        BOOST_CHECK_EQUAL(expected[i], std::to_string(digests[i]));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(multi_buffer_test_suite)
+
+BOOST_AUTO_TEST_CASE(multi_buffer_sha2_256_vectors) {
+    std::vector<std::string> in = {"", "abc", "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq"};
+    std::vector<hashes::sha2<256>::digest_type> out;
+    hashes::multi_buffer<hashes::sha2<256>>::process(in, std::back_inserter(out));
+
+    BOOST_REQUIRE_EQUAL(out.size(), 3);
+    BOOST_CHECK_EQUAL("e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855", std::to_string(out[0]));
+    BOOST_CHECK_EQUAL("ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad", std::to_string(out[1]));
+    BOOST_CHECK_EQUAL("248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1", std::to_string(out[2]));
+}
+
+BOOST_AUTO_TEST_CASE(multi_buffer_sha2_224_vectors) {
+    std::vector<std::string> in = {"", "abc"};
+    std::vector<hashes::sha2<224>::digest_type> out;
+    hashes::multi_buffer<hashes::sha2<224>>::process(in, std::back_inserter(out));
+
+    BOOST_REQUIRE_EQUAL(out.size(), 2);
+    BOOST_CHECK_EQUAL("d14a028c2a3a2bc9476102bb288234c415a2b01f828ea62ac5b3e42f", std::to_string(out[0]));
+    BOOST_CHECK_EQUAL("23097d223405d8228642a477bda255b32aadbce4bda0b3f7e36c9da7", std::to_string(out[1]));
+}
+
+BOOST_AUTO_TEST_CASE(multi_buffer_sha2_256_scalar) {
+    check_kernel<256, hashes::detail::sha2_256_scalar_lanes>(40);
+}
+
+BOOST_AUTO_TEST_CASE(multi_buffer_sha256d_vectors) {
+    std::vector<std::string> in = {"", "hello"};
+    std::vector<hashes::sha256d::digest_type> out;
+    hashes::multi_buffer<hashes::sha256d>::process(in, std::back_inserter(out));
+
+    BOOST_REQUIRE_EQUAL(out.size(), 2);
+    BOOST_CHECK_EQUAL("5df6e0e2761359d30a8275058e299fcc0381534545f55cf43e41983f5d4c9456", std::to_string(out[0]));
+    BOOST_CHECK_EQUAL("9595c9df90075148eb06860365df33584b75bff782a510c6cd4883a419833d50", std::to_string(out[1]));
+}
+
+BOOST_AUTO_TEST_CASE(multi_buffer_sha256d_scalar) {
+    check_sha256d_kernel<hashes::detail::sha2_256_scalar_lanes>(17);
+}
+
+#ifdef CRYPTO3_HAS_X86_INTRINSICS
+BOOST_AUTO_TEST_CASE(multi_buffer_sha2_256_avx2) {
+    check_kernel<256, hashes::detail::sha2_256_avx2_lanes>(1);
+    check_kernel<256, hashes::detail::sha2_256_avx2_lanes>(8);
+    check_kernel<256, hashes::detail::sha2_256_avx2_lanes>(53);
+}
+
+BOOST_AUTO_TEST_CASE(multi_buffer_sha2_256_avx512) {
+    check_kernel<256, hashes::detail::sha2_256_avx512_lanes>(3);
+    check_kernel<256, hashes::detail::sha2_256_avx512_lanes>(16);
+    check_kernel<256, hashes::detail::sha2_256_avx512_lanes>(101);
+}
+
+BOOST_AUTO_TEST_CASE(multi_buffer_sha2_224_avx2) {
+    check_kernel<224, hashes::detail::sha2_256_avx2_lanes>(29);
+}
+
+BOOST_AUTO_TEST_CASE(multi_buffer_sha256d_avx2) {
+    check_sha256d_kernel<hashes::detail::sha2_256_avx2_lanes>(1);
+    check_sha256d_kernel<hashes::detail::sha2_256_avx2_lanes>(45);
+}
+
+BOOST_AUTO_TEST_CASE(multi_buffer_sha256d_avx512) {
+    check_sha256d_kernel<hashes::detail::sha2_256_avx512_lanes>(16);
+    check_sha256d_kernel<hashes::detail::sha2_256_avx512_lanes>(77);
+}
+#endif
+
+BOOST_AUTO_TEST_CASE(multi_buffer_dispatch) {
+    for (std::size_t count : {0, 1, 2, 9, 64}) {
+        batch b(count);
+        std::vector<hashes::sha2<256>::digest_type> digests(count);
+        hashes::multi_buffer<hashes::sha2<256>>::process(b.pointers.data(), b.sizes.data(), count, digests.data());
+
+        std::vector<std::string> expected = b.expected<hashes::sha2<256>>();
+        for (std::size_t i = 0; i != count; ++i) {
+            BOOST_CHECK_EQUAL(expected[i], std::to_string(digests[i]));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(multi_buffer_generic_hash) {
+    batch b(20);
+    std::vector<hashes::sha3<256>::digest_type> digests;
+    hashes::multi_buffer<hashes::sha3<256>>::process(b.messages, std::back_inserter(digests));
+
+    std::vector<std::string> expected = b.expected<hashes::sha3<256>>();
+    BOOST_REQUIRE_EQUAL(digests.size(), expected.size());
+    for (std::size_t i = 0; i != digests.size(); ++i) {
+        BOOST_CHECK_EQUAL(expected[i], std::to_string(digests[i]));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -29,12 +29,16 @@
 #include <boost/cstdint.hpp>
 
 #include <nil/crypto3/detail/pack.hpp>
+#include <nil/crypto3/detail/static_digest.hpp>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
 #include <boost/test/data/monomorphic.hpp>
 
 #include <cstdio>
+#include <list>
+#include <string>
+#include <vector>
 
 using namespace nil::crypto3;
 using namespace nil::crypto3::detail;
@@ -1093,3 +1097,227 @@ BOOST_AUTO_TEST_CASE(bulb_to_lulb_2) {
 }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(pack_octet_word_test_suite)
+
+template<typename InputEndianness, typename OutputEndianness, typename WordType>
+void check_implode_matches_imploder() {
+    constexpr std::size_t word_bits = sizeof(WordType) * CHAR_BIT;
+    typedef imploder<InputEndianness, OutputEndianness, 8, word_bits> reference_type;
+
+    for (std::size_t words = 0; words != 19; ++words) {
+        std::vector<std::uint8_t> in(words * sizeof(WordType));
+        for (std::size_t i = 0; i != in.size(); ++i) {
+            in[i] = std::uint8_t(i * 37 + 11);
+        }
+
+        std::vector<WordType> expected(words);
+        std::vector<std::uint8_t>::const_iterator it = in.begin();
+        for (std::size_t i = 0; i != words; ++i) {
+            reference_type::implode(it, expected[i]);
+        }
+
+        std::vector<WordType> out(words);
+        pack<InputEndianness, OutputEndianness, 8, word_bits>(in.begin(), in.end(), out.begin());
+        BOOST_CHECK(out == expected);
+
+        std::vector<WordType> out_n(words);
+        pack_n<InputEndianness, OutputEndianness, 8, word_bits>(in.data(), in.size(), out_n.data());
+        BOOST_CHECK(out_n == expected);
+
+        std::list<std::uint8_t> in_list(in.begin(), in.end());
+        std::list<WordType> out_list(words);
+        pack<InputEndianness, OutputEndianness, 8, word_bits>(in_list.begin(), in_list.end(), out_list.begin());
+        BOOST_CHECK(std::equal(out_list.begin(), out_list.end(), expected.begin()));
+    }
+}
+
+template<typename InputEndianness, typename OutputEndianness, typename WordType>
+void check_explode_matches_exploder() {
+    constexpr std::size_t word_bits = sizeof(WordType) * CHAR_BIT;
+    typedef exploder<InputEndianness, OutputEndianness, word_bits, 8> reference_type;
+
+    for (std::size_t words = 0; words != 19; ++words) {
+        std::vector<WordType> in(words);
+        for (std::size_t i = 0; i != words; ++i) {
+            in[i] = WordType(UINT64_C(0x0123456789abcdef) * (i + 1));
+        }
+
+        std::vector<std::uint8_t> expected;
+        for (std::size_t i = 0; i != words; ++i) {
+            std::back_insert_iterator<std::vector<std::uint8_t>> it(expected);
+            reference_type::explode(in[i], it);
+        }
+
+        std::vector<std::uint8_t> out(words * sizeof(WordType));
+        pack<InputEndianness, OutputEndianness, word_bits, 8>(in.begin(), in.end(), out.begin());
+        BOOST_CHECK(out == expected);
+
+        std::vector<std::uint8_t> out_n(words * sizeof(WordType));
+        pack_n<InputEndianness, OutputEndianness, word_bits, 8>(in.data(), in.size(), out_n.data());
+        BOOST_CHECK(out_n == expected);
+
+        std::list<WordType> in_list(in.begin(), in.end());
+        std::list<std::uint8_t> out_list(words * sizeof(WordType));
+        pack<InputEndianness, OutputEndianness, word_bits, 8>(in_list.begin(), in_list.end(), out_list.begin());
+        BOOST_CHECK(std::equal(out_list.begin(), out_list.end(), expected.begin()));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(octets_to_words_32) {
+    check_implode_matches_imploder<big_octet_big_bit, big_octet_big_bit, std::uint32_t>();
+    check_implode_matches_imploder<little_octet_big_bit, big_octet_big_bit, std::uint32_t>();
+    check_implode_matches_imploder<big_octet_big_bit, little_octet_big_bit, std::uint32_t>();
+    check_implode_matches_imploder<little_octet_big_bit, little_octet_big_bit, std::uint32_t>();
+}
+
+BOOST_AUTO_TEST_CASE(octets_to_words_64) {
+    check_implode_matches_imploder<big_octet_big_bit, big_octet_big_bit, std::uint64_t>();
+    check_implode_matches_imploder<little_octet_big_bit, big_octet_big_bit, std::uint64_t>();
+    check_implode_matches_imploder<big_octet_big_bit, little_octet_big_bit, std::uint64_t>();
+    check_implode_matches_imploder<little_octet_big_bit, little_octet_big_bit, std::uint64_t>();
+}
+
+BOOST_AUTO_TEST_CASE(words_to_octets_32) {
+    check_explode_matches_exploder<big_octet_big_bit, big_octet_big_bit, std::uint32_t>();
+    check_explode_matches_exploder<little_octet_big_bit, big_octet_big_bit, std::uint32_t>();
+    check_explode_matches_exploder<big_octet_big_bit, little_octet_big_bit, std::uint32_t>();
+    check_explode_matches_exploder<little_octet_big_bit, little_octet_big_bit, std::uint32_t>();
+}
+
+BOOST_AUTO_TEST_CASE(words_to_octets_64) {
+    check_explode_matches_exploder<big_octet_big_bit, big_octet_big_bit, std::uint64_t>();
+    check_explode_matches_exploder<little_octet_big_bit, big_octet_big_bit, std::uint64_t>();
+    check_explode_matches_exploder<big_octet_big_bit, little_octet_big_bit, std::uint64_t>();
+    check_explode_matches_exploder<little_octet_big_bit, little_octet_big_bit, std::uint64_t>();
+}
+
+BOOST_AUTO_TEST_CASE(octets_to_words_unaligned) {
+    std::array<std::uint8_t, 41> in {};
+    for (std::size_t i = 0; i != in.size(); ++i) {
+        in[i] = std::uint8_t(i);
+    }
+    std::array<std::uint32_t, 10> out {};
+
+    pack_n<big_octet_big_bit, big_octet_big_bit, 8, 32>(in.data() + 1, 40, out.data());
+
+    for (std::size_t i = 0; i != out.size(); ++i) {
+        std::uint32_t b = std::uint32_t(4 * i + 1);
+        BOOST_CHECK_EQUAL(out[i], (b << 24) | ((b + 1) << 16) | ((b + 2) << 8) | (b + 3));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(octets_to_words_char) {
+    std::string in = "\x80\x01\x02\xff";
+    std::array<std::uint32_t, 1> out {};
+
+    pack<big_octet_big_bit, big_octet_big_bit, 8, 32>(in.begin(), in.end(), out.begin());
+
+    BOOST_CHECK_EQUAL(out[0], UINT32_C(0x800102ff));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(pack_memcpy_test_suite)
+
+template<typename InputEndianness, typename OutputEndianness, std::size_t InputValueBits, std::size_t OutputValueBits,
+         typename InputType, typename OutputType, typename InputIterator, typename OutputIterator>
+constexpr bool packs_by_memcpy() {
+    return real_packer<InputEndianness, OutputEndianness, InputValueBits, OutputValueBits, InputType,
+                       OutputType>::template is_memcpy<InputIterator, OutputIterator>::value;
+}
+
+template<typename InputEndianness, typename OutputEndianness, std::size_t InputValueBits, std::size_t OutputValueBits,
+         typename InputType, typename OutputType>
+void check_memcpy_matches_elementwise(std::size_t in_n) {
+    std::vector<InputType> in(in_n);
+    for (std::size_t i = 0; i != in_n; ++i) {
+        in[i] = InputType(UINT64_C(0x9e3779b97f4a7c15) * (i + 1));
+    }
+    std::size_t out_n = in_n * InputValueBits / OutputValueBits;
+
+    std::vector<OutputType> out(out_n);
+    pack<InputEndianness, OutputEndianness, InputValueBits, OutputValueBits>(in.begin(), in.end(), out.begin());
+
+    std::list<InputType> in_list(in.begin(), in.end());
+    std::list<OutputType> out_list(out_n);
+    pack<InputEndianness, OutputEndianness, InputValueBits, OutputValueBits>(in_list.begin(), in_list.end(),
+                                                                             out_list.begin());
+
+    BOOST_CHECK(std::equal(out.begin(), out.end(), out_list.begin()));
+}
+
+BOOST_AUTO_TEST_CASE(same_endianness_equal_size_selects_memcpy) {
+    BOOST_STATIC_ASSERT((packs_by_memcpy<big_octet_big_bit, big_octet_big_bit, 32, 32, std::uint32_t, std::uint32_t,
+                                         const std::uint32_t *, std::uint32_t *>()));
+    BOOST_STATIC_ASSERT((packs_by_memcpy<big_octet_big_bit, big_octet_big_bit, 8, 8, std::uint8_t, std::uint8_t,
+                                         std::array<std::uint8_t, 32>::const_iterator,
+                                         static_digest<256>::iterator>()));
+    BOOST_STATIC_ASSERT((packs_by_memcpy<little_octet_little_bit, little_octet_little_bit, 64, 64, std::uint64_t,
+                                         std::int64_t, std::vector<std::uint64_t>::iterator, std::int64_t *>()));
+    BOOST_STATIC_ASSERT((!packs_by_memcpy<big_octet_big_bit, big_octet_big_bit, 32, 32, std::uint32_t, std::uint32_t,
+                                          std::list<std::uint32_t>::iterator, std::uint32_t *>()));
+
+    static_digest<256> in;
+    for (std::size_t i = 0; i != in.size(); ++i) {
+        in[i] = std::uint8_t(i * 7);
+    }
+    std::array<std::uint8_t, 32> out {};
+
+    pack<big_octet_big_bit, big_octet_big_bit, 8, 8>(in.begin(), in.end(), out.begin());
+    BOOST_CHECK(std::equal(in.begin(), in.end(), out.begin()));
+
+    check_memcpy_matches_elementwise<big_octet_big_bit, big_octet_big_bit, 32, 32, std::uint32_t, std::uint32_t>(9);
+    check_memcpy_matches_elementwise<little_octet_little_bit, little_octet_little_bit, 16, 16, std::uint16_t,
+                                     std::uint16_t>(9);
+}
+
+BOOST_AUTO_TEST_CASE(single_unit_different_endianness_selects_memcpy) {
+    BOOST_STATIC_ASSERT((packs_by_memcpy<big_octet_big_bit, little_octet_big_bit, 8, 8, std::uint8_t, std::uint8_t,
+                                         const std::uint8_t *, std::uint8_t *>()));
+    BOOST_STATIC_ASSERT((packs_by_memcpy<little_unit_little_bit<32>, big_unit_little_bit<32>, 32, 32, std::uint32_t,
+                                         std::uint32_t, const std::uint32_t *, std::uint32_t *>()));
+    BOOST_STATIC_ASSERT((!packs_by_memcpy<big_octet_big_bit, little_octet_big_bit, 32, 32, std::uint32_t,
+                                          std::uint32_t, const std::uint32_t *, std::uint32_t *>()));
+    BOOST_STATIC_ASSERT((!packs_by_memcpy<big_octet_big_bit, big_octet_little_bit, 8, 8, std::uint8_t, std::uint8_t,
+                                          const std::uint8_t *, std::uint8_t *>()));
+
+    check_memcpy_matches_elementwise<big_octet_big_bit, little_octet_big_bit, 8, 8, std::uint8_t, std::uint8_t>(9);
+    check_memcpy_matches_elementwise<little_unit_little_bit<32>, big_unit_little_bit<32>, 32, 32, std::uint32_t,
+                                     std::uint32_t>(9);
+}
+
+#if defined(BOOST_ENDIAN_LITTLE_BYTE_AVAILABLE)
+typedef little_octet_big_bit host_octet_big_bit;
+typedef little_octet_little_bit host_octet_little_bit;
+typedef big_octet_big_bit foreign_octet_big_bit;
+#elif defined(BOOST_ENDIAN_BIG_BYTE_AVAILABLE)
+typedef big_octet_big_bit host_octet_big_bit;
+typedef big_octet_little_bit host_octet_little_bit;
+typedef little_octet_big_bit foreign_octet_big_bit;
+#endif
+
+#if defined(BOOST_ENDIAN_LITTLE_BYTE_AVAILABLE) || defined(BOOST_ENDIAN_BIG_BYTE_AVAILABLE)
+BOOST_AUTO_TEST_CASE(host_layout_implode_explode_selects_memcpy) {
+    BOOST_STATIC_ASSERT((packs_by_memcpy<host_octet_big_bit, host_octet_big_bit, 16, 32, std::uint16_t, std::uint32_t,
+                                         const std::uint16_t *, std::uint32_t *>()));
+    BOOST_STATIC_ASSERT((packs_by_memcpy<host_octet_little_bit, host_octet_little_bit, 32, 64, std::uint32_t,
+                                         std::uint64_t, std::array<std::uint32_t, 8>::iterator,
+                                         std::array<std::uint64_t, 4>::iterator>()));
+    BOOST_STATIC_ASSERT((packs_by_memcpy<host_octet_big_bit, host_octet_big_bit, 64, 16, std::uint64_t,
+                                         std::uint16_t, const std::uint64_t *, std::uint16_t *>()));
+    BOOST_STATIC_ASSERT((!packs_by_memcpy<foreign_octet_big_bit, foreign_octet_big_bit, 16, 32, std::uint16_t,
+                                          std::uint32_t, const std::uint16_t *, std::uint32_t *>()));
+
+    check_memcpy_matches_elementwise<host_octet_big_bit, host_octet_big_bit, 16, 32, std::uint16_t, std::uint32_t>(18);
+    check_memcpy_matches_elementwise<host_octet_little_bit, host_octet_little_bit, 32, 64, std::uint32_t,
+                                     std::uint64_t>(18);
+    check_memcpy_matches_elementwise<host_octet_big_bit, host_octet_big_bit, 64, 16, std::uint64_t, std::uint16_t>(9);
+    check_memcpy_matches_elementwise<host_octet_little_bit, host_octet_little_bit, 8, 32, std::uint8_t,
+                                     std::uint32_t>(36);
+    check_memcpy_matches_elementwise<host_octet_little_bit, host_octet_little_bit, 64, 8, std::uint64_t,
+                                     std::uint8_t>(9);
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
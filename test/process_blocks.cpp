@@ -0,0 +1,76 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE process_blocks_test
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include <boost/mpl/list.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/hash/blake2b.hpp>
+#include <nil/crypto3/hash/keccak.hpp>
+#include <nil/crypto3/hash/ripemd.hpp>
+#include <nil/crypto3/hash/sha1.hpp>
+#include <nil/crypto3/hash/sha2.hpp>
+#include <nil/crypto3/hash/sha3.hpp>
+#include <nil/crypto3/hash/tiger.hpp>
+
+using namespace nil::crypto3;
+
+// Merkle-Damgård, sponge and HAIFA constructions, with and without a dispatched compressor
+typedef boost::mpl::list<hashes::sha1, hashes::sha2<256>, hashes::sha2<512>, hashes::ripemd160, hashes::tiger<192>,
+                         hashes::keccak_1600<256>, hashes::sha3<256>, hashes::blake2b<512>>
+    hash_types;
+
+BOOST_AUTO_TEST_SUITE(process_blocks_test_suite)
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(process_blocks_matches_process_block, Hash, hash_types) {
+    typedef typename Hash::construction::type construction_type;
+    typedef typename construction_type::word_type word_type;
+    constexpr static const std::size_t block_words = construction_type::block_words;
+    constexpr static const std::size_t block_bits = construction_type::block_bits;
+
+    for (std::size_t n = 1; n <= 9; ++n) {
+        std::vector<word_type> blocks(block_words * n);
+        for (std::size_t i = 0; i != blocks.size(); ++i) {
+            blocks[i] = static_cast<word_type>(UINT64_C(0x9e3779b97f4a7c15) * (i + 1));
+        }
+
+        construction_type by_block, by_blocks;
+        for (std::size_t i = 0; i != n; ++i) {
+            typename construction_type::block_type block;
+            std::copy(blocks.begin() + i * block_words, blocks.begin() + (i + 1) * block_words, block.begin());
+            by_block.process_block(block, (i + 1) * block_bits);
+        }
+        by_blocks.process_blocks(blocks.data(), n, block_bits);
+
+        BOOST_CHECK(by_block.state() == by_blocks.state());
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
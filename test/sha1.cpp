@@ -25,7 +25,10 @@
 
 #define BOOST_TEST_MODULE sha1_test
 
+#include <cstdio>
 #include <iostream>
+#include <random>
+#include <vector>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
@@ -38,6 +41,7 @@
 #include <nil/crypto3/hash/adaptor/hashed.hpp>
 
 #include <nil/crypto3/hash/sha1.hpp>
+#include <nil/crypto3/hash/detail/sha1/sha1_sha_ni.hpp>
 
 using namespace nil::crypto3;
 using namespace nil::crypto3::accumulators;
@@ -259,4 +263,79 @@ BOOST_AUTO_TEST_CASE(sha1_preprocessor3) {
     BOOST_CHECK_EQUAL("34aa973cd4c4daa4f61eeb2bdbad27316534016f", std::to_string(s).data());
 }
 
-BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
+BOOST_AUTO_TEST_SUITE_END()
+
+#ifdef CRYPTO3_HAS_SHA_NI
+
+/*!
+ * @brief Words of the message after Merkle-Damgard strengthening, as the compressors take them.
+ */
+std::vector<std::uint32_t> padded_words(const std::string &message) {
+    std::vector<std::uint8_t> octets(message.begin(), message.end());
+    octets.push_back(0x80);
+    while (octets.size() % 64 != 56) {
+        octets.push_back(0);
+    }
+    const std::uint64_t bits = static_cast<std::uint64_t>(message.size()) * 8;
+    for (int i = 7; i >= 0; --i) {
+        octets.push_back(static_cast<std::uint8_t>(bits >> (8 * i)));
+    }
+
+    std::vector<std::uint32_t> words(octets.size() / 4);
+    for (std::size_t i = 0; i != words.size(); ++i) {
+        words[i] = (std::uint32_t(octets[4 * i]) << 24) | (std::uint32_t(octets[4 * i + 1]) << 16) |
+                   (std::uint32_t(octets[4 * i + 2]) << 8) | octets[4 * i + 3];
+    }
+    return words;
+}
+
+std::string to_hex(const std::uint32_t *words, std::size_t n) {
+    std::string r;
+    char buffer[9];
+    for (std::size_t i = 0; i != n; ++i) {
+        std::snprintf(buffer, sizeof(buffer), "%08x", words[i]);
+        r += buffer;
+    }
+    return r;
+}
+
+BOOST_AUTO_TEST_SUITE(sha1_sha_ni_test_suite)
+
+BOOST_DATA_TEST_CASE(sha1_sha_ni_hash, string_data(), array_element) {
+    if (!hashes::detail::sha1_sha_ni::supported()) {
+        return;
+    }
+    hashes::sha1::construction::type::state_type state = hashes::detail::sha1_policy::iv_generator()();
+    const std::vector<std::uint32_t> words = padded_words(array_element.first);
+    hashes::detail::sha1_sha_ni::process_blocks(state.data(), words.data(), words.size() / 16);
+
+    BOOST_CHECK_EQUAL(to_hex(state.data(), state.size()), array_element.second.data());
+}
+
+BOOST_AUTO_TEST_CASE(sha1_sha_ni_matches_portable) {
+    if (!hashes::detail::sha1_sha_ni::supported()) {
+        BOOST_TEST_MESSAGE("SHA extensions not supported, skipped");
+        return;
+    }
+    typedef hashes::davies_meyer_compressor<block::shacal1, hashes::detail::state_adder> portable_type;
+
+    std::mt19937 random(160);
+    std::vector<std::uint32_t> blocks(16 * 8);
+    for (std::size_t n = 1; n <= 8; ++n) {
+        for (std::uint32_t &w : blocks) {
+            w = random();
+        }
+        portable_type::state_type expected;
+        for (std::uint32_t &w : expected) {
+            w = random();
+        }
+        portable_type::state_type state = expected;
+
+        portable_type::process_blocks(expected, blocks.data(), n);
+        hashes::detail::sha1_sha_ni::process_blocks(state.data(), blocks.data(), n);
+        BOOST_CHECK(state == expected);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+#endif
@@ -25,8 +25,12 @@
 
 #define BOOST_TEST_MODULE sha2_test
 
+#include <cstdio>
 #include <iostream>
+#include <random>
+#include <vector>
 
+#include <boost/mpl/list.hpp>
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
 #include <boost/test/data/monomorphic.hpp>
@@ -38,6 +42,11 @@
 #include <nil/crypto3/hash/adaptor/hashed.hpp>
 
 #include <nil/crypto3/hash/sha2.hpp>
+#include <nil/crypto3/hash/detail/davies_meyer_compressor.hpp>
+#include <nil/crypto3/hash/detail/state_adder.hpp>
+#include <nil/crypto3/hash/detail/sha2/sha2_compressor.hpp>
+#include <nil/crypto3/hash/detail/sha2/sha2_256_sha_ni.hpp>
+#include <nil/crypto3/hash/detail/sha2/sha2_512_avx2.hpp>
 
 using namespace nil::crypto3;
 using namespace nil::crypto3::accumulators;
@@ -105,6 +114,18 @@ BOOST_DATA_TEST_CASE(sha2_512_range_hash, string_data("data_512"), array_element
     BOOST_CHECK_EQUAL(out, array_element.second.data());
 }
 
+BOOST_DATA_TEST_CASE(sha2_512_224_range_hash, string_data("data_512_224"), array_element) {
+    std::string out = hash<hashes::sha2<224, 512>>(array_element.first);
+
+    BOOST_CHECK_EQUAL(out, array_element.second.data());
+}
+
+BOOST_DATA_TEST_CASE(sha2_512_256_range_hash, string_data("data_512_256"), array_element) {
+    std::string out = hash<hashes::sha2<256, 512>>(array_element.first);
+
+    BOOST_CHECK_EQUAL(out, array_element.second.data());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE(sha2_stream_processor_data_driven_adaptor_test_suite)
@@ -133,6 +154,18 @@ BOOST_DATA_TEST_CASE(sha2_512_range_hash, string_data("data_512"), array_element
     BOOST_CHECK_EQUAL(out, array_element.second.data());
 }
 
+BOOST_DATA_TEST_CASE(sha2_512_224_range_hash, string_data("data_512_224"), array_element) {
+    std::string out = array_element.first | adaptors::hashed<hashes::sha2<224, 512>>;
+
+    BOOST_CHECK_EQUAL(out, array_element.second.data());
+}
+
+BOOST_DATA_TEST_CASE(sha2_512_256_range_hash, string_data("data_512_256"), array_element) {
+    std::string out = array_element.first | adaptors::hashed<hashes::sha2<256, 512>>;
+
+    BOOST_CHECK_EQUAL(out, array_element.second.data());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE(sha2_stream_processor_test_suite)
@@ -222,6 +255,47 @@ BOOST_AUTO_TEST_CASE(sha2_256_shortmsg_byte1) {
     BOOST_CHECK_EQUAL("9df5c16a3f580406f07d96149303d8c408869b32053b726cf3defd241e484957", std::to_string(d).data());
 }
 
+BOOST_AUTO_TEST_CASE(sha2_256_longmsg_contiguous) {
+    // Example from Appendix B.3: one million repetitions of "a"
+    std::vector<std::uint8_t> a(1000000, 0x61);
+    hashes::sha2<256>::digest_type d = hash<hashes::sha2<256>>(a);
+
+    BOOST_CHECK_EQUAL("cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0", std::to_string(d).data());
+}
+
+BOOST_AUTO_TEST_CASE(sha2_256_longmsg_contiguous_unaligned) {
+    // Whole blocks are packed from the input memory after the head has completed the cached block
+    std::vector<std::uint8_t> a(1000000, 0x61);
+    accumulator_set<hashes::sha2<256>> acc;
+
+    hash<hashes::sha2<256>>(a.begin(), a.begin() + 3, acc);
+    hash<hashes::sha2<256>>(a.begin() + 3, a.begin() + 500001, acc);
+    hash<hashes::sha2<256>>(a.begin() + 500001, a.end(), acc);
+
+    hashes::sha2<256>::digest_type d = extract::hash<hashes::sha2<256>>(acc);
+
+    BOOST_CHECK_EQUAL("cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0", std::to_string(d).data());
+}
+
+BOOST_AUTO_TEST_CASE(sha2_384_longmsg_contiguous) {
+    // One million repetitions of "a", compressed two blocks at a time where the schedule is vectorized
+    std::vector<std::uint8_t> a(1000000, 0x61);
+    hashes::sha2<384>::digest_type d = hash<hashes::sha2<384>>(a);
+
+    BOOST_CHECK_EQUAL("9d0e1809716474cb086e834e310a4a1ced149e9c00f24852"
+                      "7972cec5704c2a5b07b8b3dc38ecc4ebae97ddd87f3d8985",
+                      std::to_string(d).data());
+}
+
+BOOST_AUTO_TEST_CASE(sha2_512_longmsg_contiguous) {
+    std::vector<std::uint8_t> a(1000000, 0x61);
+    hashes::sha2<512>::digest_type d = hash<hashes::sha2<512>>(a);
+
+    BOOST_CHECK_EQUAL("e718483d0ce769644e2e42c7bc15b4638e1f98b13b2044285632a803afa973eb"
+                      "de0ff244877ea60a4cb0432ce577c31beb009c5c2c49aa2e4eadb217ad8cc09b",
+                      std::to_string(d).data());
+}
+
 BOOST_AUTO_TEST_CASE(sha2_384_shortmsg_bit) {
     // D.1/1
     std::array<bool, 5> a = {0, 0, 0, 1, 0};
@@ -291,6 +365,33 @@ BOOST_AUTO_TEST_CASE(sha2_512_shortmsg_byte2) {
         std::to_string(d).data());
 }
 
+BOOST_AUTO_TEST_CASE(sha2_512_t_initial_state) {
+    // FIPS 180-4, sections 5.3.6.1 and 5.3.6.2
+    constexpr hashes::detail::sha2_policy<224, 512>::state_type iv_224 =
+        hashes::detail::sha2_policy<224, 512>::initial_state;
+    constexpr hashes::detail::sha2_policy<256, 512>::state_type iv_256 =
+        hashes::detail::sha2_policy<256, 512>::initial_state;
+
+    const hashes::detail::sha2_policy<224, 512>::state_type expected_224 = {
+        {UINT64_C(0x8c3d37c819544da2), UINT64_C(0x73e1996689dcd4d6), UINT64_C(0x1dfab7ae32ff9c82),
+         UINT64_C(0x679dd514582f9fcf), UINT64_C(0x0f6d2b697bd44da8), UINT64_C(0x77e36f7304c48942),
+         UINT64_C(0x3f9d85a86a1d36c8), UINT64_C(0x1112e6ad91d692a1)}};
+    const hashes::detail::sha2_policy<256, 512>::state_type expected_256 = {
+        {UINT64_C(0x22312194fc2bf72c), UINT64_C(0x9f555fa3c84c64c2), UINT64_C(0x2393b86b6f53b151),
+         UINT64_C(0x963877195940eabd), UINT64_C(0x96283ee2a88effe3), UINT64_C(0xbe5e1e2553863992),
+         UINT64_C(0x2b0199fc2c85b8aa), UINT64_C(0x0eb72ddc81c52ca2)}};
+
+    BOOST_CHECK(iv_224 == expected_224);
+    BOOST_CHECK(iv_256 == expected_256);
+}
+
+BOOST_AUTO_TEST_CASE(sha2_512_256_longmsg_contiguous) {
+    std::vector<std::uint8_t> a(1000000, 0x61);
+    std::string out = hash<hashes::sha2<256, 512>>(a);
+
+    BOOST_CHECK_EQUAL("9a59a052930187a97038cae692f30708aa6491923ef5194394dc68d56c74fb21", out);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE(sha2_accumulator_test_suite)
@@ -640,4 +741,165 @@ BOOST_AUTO_TEST_CASE(sha224_range_hash) {
     BOOST_CHECK_EQUAL("23097d223405d8228642a477bda255b32aadbce4bda0b3f7e36c9da7", std::to_string(h).data());
 }
 
-BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
+BOOST_AUTO_TEST_CASE(sha2_truncated_construction_digest) {
+    // The 256- and 512-bit states are wider than these digests; only the leading state words are output. Run
+    // under AddressSanitizer this also catches the state being packed past the end of the digest
+    hashes::sha2<224>::construction::type c224;
+    BOOST_CHECK_EQUAL("d14a028c2a3a2bc9476102bb288234c415a2b01f828ea62ac5b3e42f",
+                      std::to_string(c224.digest()).data());
+
+    hashes::sha2<384>::construction::type c384;
+    BOOST_CHECK_EQUAL(
+        "38b060a751ac96384cd9327eb1b1e36a21fdb71114be07434c0cc7bf63f6e1da274edebfe76f65fbd51ad2f14898b95b",
+        std::to_string(c384.digest()).data());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+typedef boost::mpl::list<std::integral_constant<std::size_t, 256>, std::integral_constant<std::size_t, 512>>
+    cipher_versions;
+
+BOOST_AUTO_TEST_SUITE(sha2_compressor_test_suite)
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(sha2_compressor_matches_shacal2, CipherVersion, cipher_versions) {
+    typedef hashes::detail::sha2_compressor<CipherVersion::value> compressor_type;
+    typedef hashes::davies_meyer_compressor<block::shacal2<CipherVersion::value>, hashes::detail::state_adder>
+        reference_type;
+    typedef typename compressor_type::word_type word_type;
+
+    std::mt19937_64 random(CipherVersion::value);
+    std::vector<word_type> blocks(compressor_type::block_words * 8);
+    for (std::size_t n = 1; n <= 8; ++n) {
+        for (word_type &w : blocks) {
+            w = static_cast<word_type>(random());
+        }
+        typename reference_type::state_type expected;
+        for (word_type &w : expected) {
+            w = static_cast<word_type>(random());
+        }
+        typename compressor_type::state_type state;
+        std::copy(expected.begin(), expected.end(), state.begin());
+
+        reference_type::process_blocks(expected, blocks.data(), n);
+        compressor_type::process_blocks(state, blocks.data(), n);
+        BOOST_CHECK(std::equal(state.begin(), state.end(), expected.begin()));
+    }
+}
+
+#ifdef CRYPTO3_HAS_X86_INTRINSICS
+BOOST_AUTO_TEST_CASE(sha2_512_avx2_matches_portable) {
+    if (!hashes::detail::sha2_512_avx2::supported()) {
+        BOOST_TEST_MESSAGE("AVX2 not supported, skipped");
+        return;
+    }
+    typedef hashes::detail::sha2_compressor<512> compressor_type;
+
+    // Pairs of blocks and an odd last one
+    std::mt19937_64 random(384);
+    std::vector<std::uint64_t> blocks(16 * 9);
+    for (std::size_t n = 1; n <= 9; ++n) {
+        for (std::uint64_t &w : blocks) {
+            w = random();
+        }
+        compressor_type::state_type expected;
+        for (std::uint64_t &w : expected) {
+            w = random();
+        }
+        compressor_type::state_type state = expected;
+
+        compressor_type::process_blocks(expected, blocks.data(), n);
+        hashes::detail::sha2_512_avx2::process_blocks(state.data(), blocks.data(), n);
+        BOOST_CHECK(state == expected);
+    }
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#ifdef CRYPTO3_HAS_SHA_NI
+
+/*!
+ * @brief Words of the message after Merkle-Damgard strengthening, as the compressors take them.
+ */
+std::vector<std::uint32_t> padded_words(const std::string &message) {
+    std::vector<std::uint8_t> octets(message.begin(), message.end());
+    octets.push_back(0x80);
+    while (octets.size() % 64 != 56) {
+        octets.push_back(0);
+    }
+    const std::uint64_t bits = static_cast<std::uint64_t>(message.size()) * 8;
+    for (int i = 7; i >= 0; --i) {
+        octets.push_back(static_cast<std::uint8_t>(bits >> (8 * i)));
+    }
+
+    std::vector<std::uint32_t> words(octets.size() / 4);
+    for (std::size_t i = 0; i != words.size(); ++i) {
+        words[i] = (std::uint32_t(octets[4 * i]) << 24) | (std::uint32_t(octets[4 * i + 1]) << 16) |
+                   (std::uint32_t(octets[4 * i + 2]) << 8) | octets[4 * i + 3];
+    }
+    return words;
+}
+
+std::string to_hex(const std::uint32_t *words, std::size_t n) {
+    std::string r;
+    char buffer[9];
+    for (std::size_t i = 0; i != n; ++i) {
+        std::snprintf(buffer, sizeof(buffer), "%08x", words[i]);
+        r += buffer;
+    }
+    return r;
+}
+
+template<std::size_t Version>
+std::string sha_ni_hash(const std::string &message) {
+    typedef hashes::detail::sha2_policy<Version> policy_type;
+
+    typename policy_type::state_type state = policy_type::initial_state;
+    const std::vector<std::uint32_t> words = padded_words(message);
+    hashes::detail::sha2_256_sha_ni::process_blocks(state.data(), words.data(), words.size() / 16);
+    return to_hex(state.data(), Version / 32);
+}
+
+BOOST_AUTO_TEST_SUITE(sha2_sha_ni_test_suite)
+
+BOOST_DATA_TEST_CASE(sha2_224_sha_ni_hash, string_data("data_224"), array_element) {
+    if (!hashes::detail::sha2_256_sha_ni::supported()) {
+        return;
+    }
+    BOOST_CHECK_EQUAL(sha_ni_hash<224>(array_element.first), array_element.second.data());
+}
+
+BOOST_DATA_TEST_CASE(sha2_256_sha_ni_hash, string_data("data_256"), array_element) {
+    if (!hashes::detail::sha2_256_sha_ni::supported()) {
+        return;
+    }
+    BOOST_CHECK_EQUAL(sha_ni_hash<256>(array_element.first), array_element.second.data());
+}
+
+BOOST_AUTO_TEST_CASE(sha2_256_sha_ni_matches_portable) {
+    if (!hashes::detail::sha2_256_sha_ni::supported()) {
+        BOOST_TEST_MESSAGE("SHA extensions not supported, skipped");
+        return;
+    }
+    typedef hashes::davies_meyer_compressor<block::shacal2<256>, hashes::detail::state_adder> portable_type;
+
+    std::mt19937 random(256);
+    std::vector<std::uint32_t> blocks(16 * 8);
+    for (std::size_t n = 1; n <= 8; ++n) {
+        for (std::uint32_t &w : blocks) {
+            w = random();
+        }
+        portable_type::state_type expected;
+        for (std::uint32_t &w : expected) {
+            w = random();
+        }
+        portable_type::state_type state = expected;
+
+        portable_type::process_blocks(expected, blocks.data(), n);
+        hashes::detail::sha2_256_sha_ni::process_blocks(state.data(), blocks.data(), n);
+        BOOST_CHECK(state == expected);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+#endif
@@ -0,0 +1,99 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE sha256d_test
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/adaptor/hashed.hpp>
+#include <nil/crypto3/hash/hasher.hpp>
+
+#include <nil/crypto3/hash/sha2.hpp>
+#include <nil/crypto3/hash/sha256d.hpp>
+
+#include "test_input.hpp"
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::accumulators;
+
+BOOST_TEST_DONT_PRINT_LOG_VALUE(hashes::sha256d::digest_type)
+
+BOOST_AUTO_TEST_SUITE(sha256d_test_suite)
+
+BOOST_AUTO_TEST_CASE(sha256d_vectors) {
+    std::string empty = hash<hashes::sha256d>(std::string());
+    std::string hello = hash<hashes::sha256d>(std::string("hello"));
+    std::string adaptor = std::string("hello") | adaptors::hashed<hashes::sha256d>;
+
+    BOOST_CHECK_EQUAL("5df6e0e2761359d30a8275058e299fcc0381534545f55cf43e41983f5d4c9456", empty);
+    BOOST_CHECK_EQUAL("9595c9df90075148eb06860365df33584b75bff782a510c6cd4883a419833d50", hello);
+    BOOST_CHECK_EQUAL(hello, adaptor);
+}
+
+BOOST_AUTO_TEST_CASE(sha256d_block_header) {
+    // Bitcoin genesis block header, its hash is displayed with the octets reversed
+    std::array<std::uint8_t, 80> header = {
+        {0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+         0x00, 0x00, 0x00, 0x00, 0x3b, 0xa3, 0xed, 0xfd, 0x7a, 0x7b, 0x12, 0xb2, 0x7a, 0xc7, 0x2c, 0x3e,
+         0x67, 0x76, 0x8f, 0x61, 0x7f, 0xc8, 0x1b, 0xc3, 0x88, 0x8a, 0x51, 0x32, 0x3a, 0x9f, 0xb8, 0xaa,
+         0x4b, 0x1e, 0x5e, 0x4a, 0x29, 0xab, 0x5f, 0x49, 0xff, 0xff, 0x00, 0x1d, 0x1d, 0xac, 0x2b, 0x7c}};
+    hashes::sha256d::digest_type d = hash<hashes::sha256d>(header);
+
+    BOOST_CHECK_EQUAL("6fe28c0ab6f1b372c1a6a246ae63f74f931e8365e15a089c68d6190000000000", std::to_string(d));
+}
+
+BOOST_AUTO_TEST_CASE(sha256d_matches_sha256_twice) {
+    // Lengths around the one and two tail block boundaries and some multi-block messages
+    hashes::hasher<hashes::sha256d> h;
+    for (std::size_t size = 0; size != 200; ++size) {
+        std::vector<std::uint8_t> m = make_input(size);
+        hashes::sha2<256>::digest_type first = hash<hashes::sha2<256>>(m);
+        hashes::sha2<256>::digest_type expected = hash<hashes::sha2<256>>(first);
+
+        hashes::sha256d::digest_type d = hash<hashes::sha256d>(m);
+
+        BOOST_CHECK_EQUAL(std::to_string(expected), std::to_string(d));
+        BOOST_CHECK_EQUAL(std::to_string(expected), std::to_string(h.update(m).finalize()));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(sha256d_accumulator) {
+    accumulator_set<hashes::sha256d> acc;
+    hashes::sha256d::block_type m = {{}};
+    m[0] = 0x61626300;
+    acc(m, accumulators::bits = 24);
+
+    hashes::sha256d::digest_type s = extract::hash<hashes::sha256d>(acc);
+
+    BOOST_CHECK_EQUAL("4f8b42c22dd3729b519ba6f68d2da7cc5b2d606d05daed5ad5128cc03e6c6358", std::to_string(s));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
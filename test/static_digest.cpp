@@ -30,8 +30,13 @@
 
 #include <nil/crypto3/detail/static_digest.hpp>
 
+#include <algorithm>
 #include <iostream>
+#include <set>
 #include <sstream>
+#include <string>
+#include <unordered_set>
+#include <vector>
 
 #include <cassert>
 
@@ -101,4 +106,206 @@ BOOST_AUTO_TEST_CASE(digest3) {
     BOOST_CHECK_EQUAL(resize<16 * 3 * 4>(d), "0123456789abcdeffedcba98765432100000000000000000");
 }
 
-BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
+BOOST_AUTO_TEST_CASE(digest_istream_upper_case) {
+    std::stringstream ss("ABCDEF0123456789");
+    static_digest<64> d;
+
+    ss >> d;
+
+    BOOST_CHECK(ss);
+    BOOST_CHECK_EQUAL(d, "abcdef0123456789");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(digest_encoding_test_suite)
+
+BOOST_AUTO_TEST_CASE(hex_encoding_matches_scalar) {
+    // Sizes around the 16 and 32 octet vector strides
+    for (std::size_t size = 0; size != 100; ++size) {
+        std::vector<std::uint8_t> in(size);
+        std::string expected;
+        for (std::size_t i = 0; i != size; ++i) {
+            in[i] = static_cast<std::uint8_t>(i * 37 + size);
+            expected.push_back("0123456789abcdef"[in[i] >> 4]);
+            expected.push_back("0123456789abcdef"[in[i] & 0x0F]);
+        }
+
+        std::string out(detail::hex_encoding::encoded_size(size), '\0');
+        BOOST_CHECK(detail::hex_encoding::encode(in.data(), size, &out[0]) == out.data() + out.size());
+        BOOST_CHECK_EQUAL(out, expected);
+
+        std::vector<std::uint8_t> decoded(size);
+        BOOST_CHECK(detail::hex_encoding::decode(out.data(), size, decoded.data()));
+        BOOST_CHECK(decoded == in);
+
+        for (char &c : out) {
+            c = static_cast<char>(std::toupper(c));
+        }
+        std::fill(decoded.begin(), decoded.end(), 0);
+        BOOST_CHECK(detail::hex_encoding::decode(out.data(), size, decoded.data()));
+        BOOST_CHECK(decoded == in);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hex_decoding_rejects_invalid) {
+    const std::size_t size = 48;
+    std::string valid(2 * size, '0');
+    for (std::size_t i = 0; i != valid.size(); ++i) {
+        valid[i] = "0123456789abcdefABCDEF"[i % 22];
+    }
+
+    std::vector<std::uint8_t> out(size);
+    BOOST_CHECK(detail::hex_encoding::decode(valid.data(), size, out.data()));
+
+    // Neighbours of every accepted range and a non-ASCII character, at every position
+    for (char bad : {'/', ':', '@', 'G', '`', 'g', ' ', '\xB0'}) {
+        for (std::size_t i = 0; i != valid.size(); ++i) {
+            std::string s = valid;
+            s[i] = bad;
+            BOOST_CHECK(!detail::hex_encoding::decode(s.data(), size, out.data()));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(digest_hex_round_trip) {
+    static_digest<256> d;
+    BOOST_CHECK(from_hex("ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad", 64, d));
+
+    std::array<char, digest_encoded_size<256>::hex> s;
+    BOOST_CHECK(to_hex(d, s.data()) == s.data() + s.size());
+    BOOST_CHECK_EQUAL(std::string(s.data(), s.size()),
+                      "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+
+    BOOST_CHECK(!from_hex("ba7816bf", 8, d));
+}
+
+BOOST_AUTO_TEST_CASE(digest_base64url) {
+    static_digest<256> d256;
+    from_hex("ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad", 64, d256);
+    std::array<char, digest_encoded_size<256>::base64url> s256;
+    BOOST_CHECK(to_base64url(d256, s256.data()) == s256.data() + s256.size());
+    BOOST_CHECK_EQUAL(std::string(s256.data(), s256.size()), "ungWv48Bz-pBQUDeXa4iI7ADYaOWF3qctBD_YfIAFa0");
+
+    static_digest<224> d224;
+    from_hex("23097d223405d8228642a477bda255b32aadbce4bda0b3f7e36c9da7", 56, d224);
+    std::array<char, digest_encoded_size<224>::base64url> s224;
+    BOOST_CHECK(to_base64url(d224, s224.data()) == s224.data() + s224.size());
+    BOOST_CHECK_EQUAL(std::string(s224.data(), s224.size()), "Iwl9IjQF2CKGQqR3vaJVsyqtvOS9oLP342ydpw");
+}
+
+BOOST_AUTO_TEST_CASE(digest_base32) {
+    static_digest<256> d256;
+    from_hex("ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad", 64, d256);
+    std::array<char, digest_encoded_size<256>::base32> s256;
+    BOOST_CHECK(to_base32(d256, s256.data()) == s256.data() + s256.size());
+    BOOST_CHECK_EQUAL(std::string(s256.data(), s256.size()), "XJ4BNP4PAHH6UQKBIDPF3LRCEOYAGYNDSYLXVHFUCD7WD4QACWWQ");
+
+    static_digest<160> d160;
+    from_hex("a9993e364706816aba3e25717850c26c9cd0d89d", 40, d160);
+    std::array<char, digest_encoded_size<160>::base32> s160;
+    BOOST_CHECK(to_base32(d160, s160.data()) == s160.data() + s160.size());
+    BOOST_CHECK_EQUAL(std::string(s160.data(), s160.size()), "VGMT4NSHA2AWVOR6EVYXQUGCNSONBWE5");
+
+    static_digest<224> d224;
+    from_hex("23097d223405d8228642a477bda255b32aadbce4bda0b3f7e36c9da7", 56, d224);
+    std::array<char, digest_encoded_size<224>::base32> s224;
+    BOOST_CHECK(to_base32(d224, s224.data()) == s224.data() + s224.size());
+    BOOST_CHECK_EQUAL(std::string(s224.data(), s224.size()), "EMEX2IRUAXMCFBSCUR333ISVWMVK3PHEXWQLH57DNSO2O");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(digest_key_test_suite)
+
+template<std::size_t DigestBits>
+static_digest<DigestBits> make_digest(std::uint32_t seed) {
+    static_digest<DigestBits> d;
+    for (octet_type &o : d) {
+        seed = seed * 1103515245 + 12345;
+        o = static_cast<octet_type>(seed >> 16);
+    }
+    return d;
+}
+
+BOOST_AUTO_TEST_CASE(digest_order_is_lexicographic) {
+    // Pairs differing at every position, in both directions, and equal pairs
+    for (std::uint32_t seed = 0; seed != 8; ++seed) {
+        const static_digest<256> a = make_digest<256>(seed);
+        for (std::size_t i = 0; i != a.size(); ++i) {
+            for (int delta : {-1, 1, 0x80}) {
+                static_digest<256> b = a;
+                b[i] = static_cast<octet_type>(b[i] + delta);
+
+                const bool expected = std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end());
+                BOOST_CHECK_EQUAL(a < b, expected);
+                BOOST_CHECK_EQUAL(b < a, !expected);
+                BOOST_CHECK(a != b);
+            }
+        }
+        BOOST_CHECK(!(a < a));
+        BOOST_CHECK(a <= a);
+        BOOST_CHECK(a == a);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(digest_order_different_sizes) {
+    const static_digest<256> a = make_digest<256>(1);
+    static_digest<160> prefix = truncate<160>(a);
+
+    // A proper prefix orders first and never compares equal
+    BOOST_CHECK(prefix < a);
+    BOOST_CHECK(!(a < prefix));
+    BOOST_CHECK(prefix != a);
+
+    prefix[19] = static_cast<octet_type>(prefix[19] + 1);
+    BOOST_CHECK(a < prefix);
+    BOOST_CHECK(!(prefix < a));
+}
+
+BOOST_AUTO_TEST_CASE(digest_equality_tail) {
+    // 224 bits is not a whole number of 64-bit words
+    const static_digest<224> a = make_digest<224>(2);
+    for (std::size_t i = 0; i != a.size(); ++i) {
+        static_digest<224> b = a;
+        b[i] ^= 0x01;
+        BOOST_CHECK(!(a == b));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(digest_hash_is_first_word) {
+    const static_digest<256> a = make_digest<256>(3);
+    std::size_t expected = 0;
+    std::memcpy(&expected, a.data(), sizeof(expected));
+    BOOST_CHECK_EQUAL(std::hash<static_digest<256>>()(a), expected);
+
+    // Shorter than a machine word
+    static_digest<32> b;
+    b.fill(0x5A);
+    std::size_t short_expected = 0;
+    std::memcpy(&short_expected, b.data(), b.size());
+    BOOST_CHECK_EQUAL(std::hash<static_digest<32>>()(b), short_expected);
+}
+
+BOOST_AUTO_TEST_CASE(digest_as_container_key) {
+    std::set<static_digest<256>> ordered;
+    std::unordered_set<static_digest<256>> unordered;
+    for (std::uint32_t seed = 0; seed != 1000; ++seed) {
+        ordered.insert(make_digest<256>(seed % 500));
+        unordered.insert(make_digest<256>(seed % 500));
+    }
+
+    BOOST_CHECK_EQUAL(ordered.size(), 500);
+    BOOST_CHECK_EQUAL(unordered.size(), 500);
+    BOOST_CHECK(std::is_sorted(ordered.begin(), ordered.end(),
+                               [](const static_digest<256> &a, const static_digest<256> &b) {
+                                   return std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end());
+                               }));
+    for (std::uint32_t seed = 0; seed != 500; ++seed) {
+        BOOST_CHECK(ordered.count(make_digest<256>(seed)));
+        BOOST_CHECK(unordered.count(make_digest<256>(seed)));
+    }
+    BOOST_CHECK(!unordered.count(make_digest<256>(500)));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,147 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE static_hash_test
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/static_hash.hpp>
+
+#include "test_input.hpp"
+
+using namespace nil::crypto3;
+
+constexpr int hex_value(char c) {
+    return c >= 'a' ? c - 'a' + 10 : c - '0';
+}
+
+template<std::size_t DigestBits, std::size_t N>
+constexpr bool digest_equals(const static_digest<DigestBits> &d, const char (&hex)[N]) {
+    if (N - 1 != 2 * d.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i != d.size(); ++i) {
+        if (d[i] != hex_value(hex[2 * i]) * 16 + hex_value(hex[2 * i + 1])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(digest_equals(hashes::static_hash<hashes::sha2<224>>(""),
+                            "d14a028c2a3a2bc9476102bb288234c415a2b01f828ea62ac5b3e42f"),
+              "sha2<224>");
+static_assert(digest_equals(hashes::static_hash<hashes::sha2<256>>("abc"),
+                            "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad"),
+              "sha2<256>");
+static_assert(digest_equals(hashes::static_hash<hashes::sha2<256>>(
+                                "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq"),
+                            "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1"),
+              "sha2<256> two tail blocks");
+static_assert(digest_equals(hashes::static_hash<hashes::sha2<384>>("abc"),
+                            "cb00753f45a35e8bb5a03d699ac65007272c32ab0eded163"
+                            "1a8b605a43ff5bed8086072ba1e7cc2358baeca134c825a7"),
+              "sha2<384>");
+static_assert(digest_equals(hashes::static_hash<hashes::sha2<512>>("abc"),
+                            "ddaf35a193617abacc417349ae20413112e6fa4e89a97ea20a9eeee64b55d39a"
+                            "2192992a274fc1a836ba3c23a3feebbd454d4423643ce80e2a9ac94fa54ca49f"),
+              "sha2<512>");
+static_assert(digest_equals(hashes::static_hash<hashes::sha2<256, 512>>("abc"),
+                            "53048e2681941ef99b2e29b76b4c7dabe4c2d0c634fc6d46e0e2f13107e7af23"),
+              "sha2<256, 512>");
+static_assert(digest_equals(hashes::static_hash<hashes::keccak_1600<256>>(""),
+                            "c5d2460186f7233c927e7db2dcc703c0e500b653ca82273b7bfad8045d85a470"),
+              "keccak_1600<256>");
+static_assert(digest_equals(hashes::static_hash<hashes::sha3<256>>("abc"),
+                            "3a985da74fe225b2045c172d6bd390bd855f086e3e9d525b46bfe24511431532"),
+              "sha3<256>");
+static_assert(digest_equals(hashes::static_hash<hashes::sha3<512>>(
+                                "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq"),
+                            "04a371e84ecfb5b8b77cb48610fca8182dd457ce6f326a0fd3d7ec2f1e91636d"
+                            "ee691fbe0c985302ba1b0d8dc78c086346b533b49c030d99a27daf1139d6e75e"),
+              "sha3<512>");
+static_assert(digest_equals(hashes::static_hash<hashes::blake2b<256>>("abc"),
+                            "bddd813c634239723171ef3fee98579b94964e3bb1cb3e427262c8c068d52319"),
+              "blake2b<256>");
+static_assert(digest_equals(hashes::static_hash<hashes::blake2b<512>>(""),
+                            "786a02f742015903c6c6fd852552d272912f4740e15847618a86e217f71f5419"
+                            "d25e1031afee585313896444934eb04b903a685b1448b755d56f701afe9be2ce"),
+              "blake2b<512>");
+
+template<typename Hash>
+void check_static_matches_runtime() {
+    // Lengths around every block and padding boundary of the supported hashes
+    for (std::size_t size = 0; size != 400; ++size) {
+        std::string m = make_input<std::string>(size);
+
+        typename Hash::digest_type expected = hash<Hash>(m);
+        BOOST_CHECK_EQUAL(hashes::static_hash<Hash>(std::string_view(m)), expected);
+        BOOST_CHECK_EQUAL(hashes::static_hash<Hash>(reinterpret_cast<const std::uint8_t *>(m.data()), size),
+                          expected);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(static_hash_test_suite)
+
+BOOST_AUTO_TEST_CASE(static_hash_literal) {
+    constexpr hashes::sha2<256>::digest_type d = hashes::static_hash<hashes::sha2<256>>("abc");
+
+    BOOST_CHECK_EQUAL("ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad", std::to_string(d).data());
+}
+
+BOOST_AUTO_TEST_CASE(static_hash_sha2_matches_runtime) {
+    check_static_matches_runtime<hashes::sha2<224>>();
+    check_static_matches_runtime<hashes::sha2<256>>();
+    check_static_matches_runtime<hashes::sha2<384>>();
+    check_static_matches_runtime<hashes::sha2<512>>();
+}
+
+BOOST_AUTO_TEST_CASE(static_hash_keccak_matches_runtime) {
+    check_static_matches_runtime<hashes::keccak_1600<224>>();
+    check_static_matches_runtime<hashes::keccak_1600<256>>();
+    check_static_matches_runtime<hashes::keccak_1600<384>>();
+    check_static_matches_runtime<hashes::keccak_1600<512>>();
+}
+
+BOOST_AUTO_TEST_CASE(static_hash_sha3_matches_runtime) {
+    check_static_matches_runtime<hashes::sha3<224>>();
+    check_static_matches_runtime<hashes::sha3<256>>();
+    check_static_matches_runtime<hashes::sha3<384>>();
+    check_static_matches_runtime<hashes::sha3<512>>();
+}
+
+BOOST_AUTO_TEST_CASE(static_hash_blake2b_matches_runtime) {
+    check_static_matches_runtime<hashes::blake2b<224>>();
+    check_static_matches_runtime<hashes::blake2b<256>>();
+    check_static_matches_runtime<hashes::blake2b<384>>();
+    check_static_matches_runtime<hashes::blake2b<512>>();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,121 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE tree_hash_test
+
+#include <string>
+#include <vector>
+
+#include <boost/mpl/list.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/tree_hash.hpp>
+
+#include <nil/crypto3/hash/blake2b.hpp>
+#include <nil/crypto3/hash/sha2.hpp>
+#include <nil/crypto3/hash/sha3.hpp>
+
+#include "test_input.hpp"
+
+using namespace nil::crypto3;
+
+typedef boost::mpl::list<hashes::sha2<256>, hashes::sha3<256>, hashes::blake2b<512>> hash_types;
+
+template<typename Hash>
+typename Hash::digest_type prefixed(octet_type prefix, const std::vector<octet_type> &data) {
+    std::vector<octet_type> m(1, prefix);
+    m.insert(m.end(), data.begin(), data.end());
+    return hash<Hash>(m);
+}
+
+template<typename Hash, typename... Digests>
+typename Hash::digest_type parent(const Digests &...children) {
+    std::vector<octet_type> m;
+    for (const typename Hash::digest_type &d : {children...}) {
+        m.insert(m.end(), d.begin(), d.end());
+    }
+    return prefixed<Hash>(0x01, m);
+}
+
+BOOST_AUTO_TEST_SUITE(tree_hash_test_suite)
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(tree_hash_structure, Hash, hash_types) {
+    typedef hashes::tree_hash<Hash, 100> tree_type;
+    hashes::sequential_executor executor;
+
+    std::vector<octet_type> input = make_input(250);
+    std::vector<octet_type> a(input.begin(), input.begin() + 100), b(input.begin() + 100, input.begin() + 200),
+        c(input.begin() + 200, input.end());
+
+    typename Hash::digest_type la = prefixed<Hash>(0x00, a), lb = prefixed<Hash>(0x00, b),
+                               lc = prefixed<Hash>(0x00, c);
+
+    // Empty input and a single chunk are a single leaf
+    BOOST_CHECK_EQUAL(std::to_string(tree_type::process(std::vector<octet_type>(), executor)),
+                      std::to_string(prefixed<Hash>(0x00, std::vector<octet_type>())));
+    BOOST_CHECK_EQUAL(std::to_string(tree_type::process(a, executor)), std::to_string(la));
+
+    // Two chunks
+    std::vector<octet_type> ab(input.begin(), input.begin() + 200);
+    BOOST_CHECK_EQUAL(std::to_string(tree_type::process(ab, executor)), std::to_string(parent<Hash>(la, lb)));
+
+    // Three chunks, the lone third leaf is carried up
+    BOOST_CHECK_EQUAL(std::to_string(tree_type::process(input, executor)),
+                      std::to_string(parent<Hash>(parent<Hash>(la, lb), lc)));
+
+    // Three chunks with fan-in 4
+    BOOST_CHECK_EQUAL(std::to_string(hashes::tree_hash<Hash, 100, 4>::process(input, executor)),
+                      std::to_string(parent<Hash>(la, lb, lc)));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(tree_hash_thread_count_independent, Hash, hash_types) {
+    typedef hashes::tree_hash<Hash, 1000, 3> tree_type;
+
+    for (std::size_t size : {0, 1, 999, 1000, 1001, 37000}) {
+        std::vector<octet_type> input = make_input(size);
+
+        hashes::sequential_executor executor;
+        std::string expected = std::to_string(tree_type::process(input, executor));
+
+        for (std::size_t threads : {1, 2, 3, 7}) {
+            hashes::thread_pool pool(threads);
+            BOOST_CHECK_EQUAL(expected, std::to_string(tree_type::process(input.data(), input.size(), pool)));
+        }
+        BOOST_CHECK_EQUAL(expected, std::to_string(tree_type::process(input)));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(tree_hash_string_input) {
+    typedef hashes::tree_hash<hashes::sha2<256>, 4> tree_type;
+    hashes::thread_pool pool(2);
+
+    std::string input = "abcdefghij";
+    std::vector<octet_type> octets(input.begin(), input.end());
+    BOOST_CHECK_EQUAL(std::to_string(tree_type::process(input, pool)),
+                      std::to_string(tree_type::process(octets, pool)));
+}
+
+BOOST_AUTO_TEST_SUITE_END()